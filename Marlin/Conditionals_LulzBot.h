@@ -218,6 +218,7 @@
     #define LULZBOT_MACHINE_UUID "a952577d-8722-483a-999d-acdc9e772b7b"
     #define LULZBOT_USE_EXPERIMENTAL_FEATURES
     #define LULZBOT_USB_FLASH_DRIVE_SUPPORT
+    #define LULZBOT_USB_READ_AHEAD_BLOCKS 8
     #define LULZBOT_SDSUPPORT
     #define LULZBOT_SDSUPPORT_DEBUG
     #define LULZBOT_HAS_CALIBRATION_CUBE
@@ -2116,7 +2117,7 @@
             u8g.drawStr(61,62,"v"); \
             u8g.drawStr(66,62,SHORT_BUILD_VERSION LULZBOT_FW_VERSION); \
         } while( u8g.nextPage() ); \
-        safe_delay(CUSTOM_BOOTSCREEN_TIMEOUT); \
+        BOOTSCREEN_DELAY(CUSTOM_BOOTSCREEN_TIMEOUT); \
         u8g.setFont(MENU_FONT_NAME); \
     }
 
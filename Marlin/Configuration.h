@@ -719,6 +719,12 @@
  * See https://github.com/synthetos/TinyG/wiki/Jerk-Controlled-Motion-Explained
  */
 #define S_CURVE_ACCELERATION LULZBOT_S_CURVE_ACCELERATION
+#if ENABLED(S_CURVE_ACCELERATION)
+  // Plan speed changes so that jerk, the rate of change of acceleration,
+  // stays within this limit. Small speed changes then take longer, and the
+  // planner takes that into account, so planned speeds are always reached.
+  //#define S_CURVE_JERK_LIMIT 100000 // (mm/s^3)
+#endif
 
 //===========================================================================
 //============================= Z Probe Options =============================
@@ -853,6 +859,21 @@
 //   Set to 3 or more for slow probes, averaging the results.
 #define MULTIPLE_PROBING LULZBOT_MULTIPLE_PROBING
 
+/**
+ * Adaptive probing: take slow samples at each point until their standard
+ * deviation is within ADAPTIVE_PROBING_TOLERANCE, up to a maximum count.
+ * Samples further than ADAPTIVE_PROBING_MAD_LIMIT scaled MADs from the median
+ * are rejected before averaging. Replaces the MULTIPLE_PROBING average.
+ * With MULTIPLE_PROBING 2 the fast probe is still used for the approach.
+ */
+//#define ADAPTIVE_PROBING
+#if ENABLED(ADAPTIVE_PROBING)
+  #define ADAPTIVE_PROBING_MIN_SAMPLES 2
+  #define ADAPTIVE_PROBING_MAX_SAMPLES 6
+  #define ADAPTIVE_PROBING_TOLERANCE   0.005 // (mm) Stop when the samples agree this well
+  #define ADAPTIVE_PROBING_MAD_LIMIT   3     // Reject samples beyond this many MADs
+#endif
+
 /**
  * Z probes require clearance when deploying, stowing, and moving between
  * probe points to avoid hitting the bed and other hardware.
@@ -1093,6 +1114,15 @@
   #define SEGMENT_LEVELED_MOVES
   #define LEVELED_SEGMENT_LENGTH 5.0 // (mm) Length of all segments (except the last one)
 
+  /**
+   * Store several meshes in EEPROM, e.g. one per build plate.
+   * Meshes are compressed to about one byte per point (delta-encoded
+   * microns) with a CRC per slot. Bilinear and Mesh leveling only.
+   * Save with 'M420 W<slot>' and load with 'M420 L<slot>'.
+   * Requires EEPROM_SETTINGS.
+   */
+  //#define MESH_STORAGE_SLOTS
+
   /**
    * Enable the G26 Mesh Validation Pattern tool.
    */
@@ -1137,6 +1167,17 @@
       #define BILINEAR_SUBDIVISIONS 3
     #endif
 
+    /**
+     * Bed temperature compensation. Each grid point gets a linear
+     * coefficient for Z change per degree of bed temperature, and the
+     * active mesh follows the bed temperature. 'G76 S<temp>' probes a
+     * second mesh at another temperature to fill the coefficients.
+     */
+    //#define MESH_THERMAL_COMPENSATION
+    #if ENABLED(MESH_THERMAL_COMPENSATION)
+      #define MESH_THERMAL_RESOLUTION 0.5 // (°C) Shift the mesh after this much change
+    #endif
+
   #endif
 
 #elif ENABLED(AUTO_BED_LEVELING_UBL)
@@ -1471,6 +1512,18 @@
  * View the current statistics with M78.
  */
 #define PRINTCOUNTER LULZBOT_PRINTCOUNTER
+#if ENABLED(PRINTCOUNTER)
+  // Also count travel per axis, filament per extruder, heater-on time and
+  // thermal faults per heater. Each save goes to the next of several
+  // CRC-checked slots near the end of EEPROM. Report as JSON with 'M78 J'.
+  // The slots sit below the stored meshes, so enabling or disabling this
+  // changes the EEPROM version. Stored settings are reset and stored
+  // meshes (UBL or MESH_STORAGE_SLOTS) must be probed and saved again.
+  //#define PRINTCOUNTER_MAINTENANCE
+  #if ENABLED(PRINTCOUNTER_MAINTENANCE)
+    #define PRINTCOUNTER_SLOTS 4   // Records in the ring (2-16)
+  #endif
+#endif
 
 //=============================================================================
 //============================= LCD and SD support ============================
@@ -412,6 +412,11 @@
 // Enable this if X or Y can't home without homing the other axis first.
 //#define CODEPENDENT_XY_HOMING
 
+// Home X and Y at the same time, each axis stopping at its own endstop,
+// then bump both together. Replaces QUICK_HOME. Cartesian only.
+// Dual Z endstops already home both Z steppers together.
+//#define PARALLEL_HOMING
+
 /**
  * Z Steppers Auto-Alignment
  * Add the G34 command to align multiple Z steppers using a bed probe.
@@ -527,6 +532,27 @@
  */
 //#define ADAPTIVE_STEP_SMOOTHING
 
+/**
+ * Input Shaping
+ * Cancel the ringing (ghosting) of the X and Y axes at their resonant frequency.
+ * Each step event is split into impulses spread over part of a ringing period,
+ * which rounds corners by a fraction of a millimeter. Measure the frequency by
+ * counting the ripples of a ghost over their distance at a known speed.
+ * Requires a 32-bit processor and a Cartesian machine.
+ *
+ * Use M593 to change the settings at runtime.
+ */
+//#define INPUT_SHAPING
+#if ENABLED(INPUT_SHAPING)
+  #define SHAPING_TYPE        SHAPER_MZV  // SHAPER_ZV, SHAPER_ZVD or SHAPER_MZV
+  #define SHAPING_FREQ_X      40          // (Hz) Resonant frequency of X. 0 to disable.
+  #define SHAPING_FREQ_Y      40          // (Hz) Resonant frequency of Y. 0 to disable.
+  #define SHAPING_DAMPING_X   0.1         // Damping ratio of X (0-0.99)
+  #define SHAPING_DAMPING_Y   0.1         // Damping ratio of Y (0-0.99)
+  #define SHAPING_BUFFER_SIZE 1024        // Step events held per axis for the echoes. Must cover
+                                          // the longest echo delay at the highest step rate.
+#endif
+
 /**
  * Custom Microstepping
  * Override as-needed for your setup. Up to 3 MS pins are supported.
@@ -681,8 +707,40 @@
   #if ENABLED(POWER_LOSS_RECOVERY)
     //#define POWER_LOSS_PIN   44     // Pin to detect power loss
     //#define POWER_LOSS_STATE HIGH   // State of pin indicating power loss
+
+    // Append each save to a preallocated contiguous file with raw block writes
+    // instead of rewriting the recovery file through the FAT on every save.
+    //#define POWER_LOSS_JOURNAL
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      #define POWER_LOSS_JOURNAL_RECORDS 8  // Records kept in the ring (2-255)
+    #endif
+
+    // Resume at the G0/G1 move that was running, from the point the steppers had
+    // reached, instead of the last line read plus a copy of the command queue.
+    //#define POWER_LOSS_EXACT_RESUME
+    #if ENABLED(POWER_LOSS_EXACT_RESUME)
+      #define POWER_LOSS_EXACT_INTERVAL 2   // (s) Save this often as well as on every Z raise
+    #endif
   #endif
 
+  /**
+   * Index the working directory once so the SD menu, sorting, and file
+   * selection seek straight to each entry instead of re-reading the
+   * directory from the start for every file name. Costs 2 bytes per entry.
+   */
+  //#define SDCARD_DIR_INDEX
+  #if ENABLED(SDCARD_DIR_INDEX)
+    #define SDCARD_DIR_INDEX_LIMIT 64   // Items indexed per folder. Later items are found by reading.
+  #endif
+
+  /**
+   * Scan the selected file in the background and write NAME.IDX beside it
+   * with each layer's position, estimated time and filament. Progress and
+   * M27 then follow the estimated time, and 'M26 L<layer>' seeks to the
+   * start of a layer to restart a failed print. Costs about 800 bytes of RAM.
+   */
+  //#define SDCARD_FILE_INDEX
+
   /**
    * Sort SD file listings in alphabetical order.
    *
@@ -762,6 +820,11 @@
   #if ENABLED(USB_FLASH_DRIVE_SUPPORT)
     #define USB_CS_PIN         SDSS
     #define USB_INTR_PIN       SD_DETECT_PIN
+    // Read sequential sectors this many at a time, in one bulk transfer,
+    // and serve the following reads from RAM. Costs 512 bytes per sector.
+    #if defined(LULZBOT_USB_READ_AHEAD_BLOCKS)
+    #define USB_READ_AHEAD_BLOCKS LULZBOT_USB_READ_AHEAD_BLOCKS
+    #endif
   #endif
 
   /**
@@ -782,6 +845,22 @@
 
   // Add an optimized binary file transfer mode, initiated with 'M28 B1'
   //#define FAST_FILE_TRANSFER
+  #if ENABLED(FAST_FILE_TRANSFER)
+    // Accept packets up to this size and write the file to a preallocated
+    // contiguous area with multi-block writes. Costs 512 bytes of RAM plus
+    // the packet size. Each packet is written in one multi-block sequence,
+    // so 32-bit boards gain from 2048 or more. On a UART serial port the
+    // RX_BUFFER_SIZE must hold a whole packet.
+    //#define FAST_FILE_TRANSFER_PACKET_SIZE 512
+  #endif
+
+  // Write the M928 log to a preallocated contiguous area, buffered in RAM
+  // and written one whole block at a time from idle(). Logging then needs
+  // no FAT or directory updates while printing. Costs 1K of RAM.
+  //#define SDCARD_LOG_WRITE_BEHIND
+  #if ENABLED(SDCARD_LOG_WRITE_BEHIND)
+    #define SDCARD_LOG_PREALLOCATE_KB 1024 // Reserved when the log opens. Logging past it writes through the file system.
+  #endif
 
 #endif // SDSUPPORT
 
@@ -871,6 +950,21 @@
   //#define WATCHDOG_RESET_MANUAL
 #endif
 
+/**
+ * Fast Boot
+ *
+ * Get the host connection answered sooner after a reset.
+ *  - Load settings in a single pass, reverting to defaults on a CRC error.
+ *  - Hold the boot screen from the LCD update instead of blocking startup.
+ *    Only the custom boot screen is shown, if enabled.
+ *    Character LCDs skip the boot screen.
+ *  - Run the TMC connection test from the main loop.
+ */
+//#define FAST_BOOT
+#if ENABLED(FAST_BOOT)
+  //#define FAST_BOOT_REPORT  // Report the time taken by each boot stage
+#endif
+
 // @section lcd
 
 /**
@@ -963,6 +1057,17 @@
   #define G29_ACTION_ON_FAILURE "probe_failed"
 #endif
 
+/**
+ * Probe only the part of the bilinear grid covered by the print.
+ * 'G29 K L<left> R<right> F<front> B<back>' keeps the stored grid and
+ * re-probes only the grid points enclosing the given print area (plus
+ * a margin), leaving the rest of the mesh untouched.
+ */
+//#define G29_PROBE_PRINT_AREA
+#if ENABLED(G29_PROBE_PRINT_AREA)
+  #define G29_PRINT_AREA_MARGIN 10  // (mm) Extra border around the print area
+#endif
+
 // @section extras
 
 //
@@ -972,12 +1077,39 @@
 #if ENABLED(ARC_SUPPORT)
   #define MM_PER_ARC_SEGMENT  1   // Length of each arc segment
   #define N_ARC_CORRECTION   25   // Number of intertpolated segments between corrections
+  //#define ARC_CHORD_SEGMENTS    // Size segments by chord error and feedrate instead of MM_PER_ARC_SEGMENT
+  #if ENABLED(ARC_CHORD_SEGMENTS)
+    #define ARC_CHORD_TOLERANCE  0.005 // (mm) Largest distance between a segment and the true arc
+    #define MIN_ARC_SEGMENT_TIME 0.01  // (s) Shortest segment duration at the requested feedrate
+  #endif
+  //#define NATIVE_ARC_BLOCKS     // (32-bit with FPU) Queue each XY arc as one block, traced by the stepper
   //#define ARC_P_CIRCLES         // Enable the 'P' parameter to specify complete circles
   //#define CNC_WORKSPACE_PLANES  // Allow G2/G3 to operate in XY, ZX, or YZ planes
 #endif
 
 // Support for G5 with XYZE destination and IJPQ offsets. Requires ~2666 bytes.
 //#define BEZIER_CURVE_SUPPORT
+#if ENABLED(BEZIER_CURVE_SUPPORT)
+  #define BEZIER_TOLERANCE 0.05 // (mm) Largest distance between a G5 curve and its segments
+#endif
+
+/**
+ * Path Blending
+ *
+ * Hold each G0/G1 move until the next one arrives. Merge runs of nearly
+ * collinear moves into one and cut the corners between the rest, so the
+ * planner sees fewer and gentler junctions with finely tessellated models.
+ * Only moves in the XY plane are affected.
+ *
+ * G64 P<blend> Q<merge> sets the tolerances and turns blending on.
+ * G61 turns it off.
+ */
+//#define PATH_BLENDING
+#if ENABLED(PATH_BLENDING)
+  #define PATH_BLEND_TOLERANCE 0.05 // (mm) Largest distance from a corner to its blend. 0 to only merge.
+  #define PATH_MERGE_TOLERANCE 0.01 // (mm) Largest distance from a merged point to the merged move
+  #define PATH_MERGE_POINTS       8 // Most joints merged away in one move. 8 bytes of RAM each.
+#endif
 
 // G38.2 and G38.3 Probe Target
 // Set MULTIPLE_PROBING if you want G38 to double touch
@@ -122,6 +122,14 @@
   #include "feature/bedlevel/bedlevel.h"
 #endif
 
+#if ENABLED(MESH_THERMAL_COMPENSATION)
+  #include "feature/bedlevel/abl/mesh_thermal.h"
+#endif
+
+#if ENABLED(PATH_BLENDING)
+  #include "feature/path_blending.h"
+#endif
+
 #if ENABLED(ADVANCED_PAUSE_FEATURE) && ENABLED(PAUSE_PARK_NO_STEPPER_TIMEOUT)
   #include "feature/pause.h"
 #endif
@@ -257,6 +265,9 @@ void protected_pin_err() {
 }
 
 void quickstop_stepper() {
+  #if ENABLED(PATH_BLENDING)
+    path_blending.discard();
+  #endif
   planner.quick_stop();
   planner.synchronize();
   set_current_from_steppers_for_axis(ALL_AXES);
@@ -524,6 +535,30 @@ void manage_inactivity(const bool ignore_stepper_queue/*=false*/) {
   }
 }
 
+#if ENABLED(FAST_BOOT_REPORT)
+
+  static millis_t boot_stage_ms; // = 0
+
+  /**
+   * Report the time spent in a boot stage since the previous one
+   */
+  static void report_boot_stage(PGM_P const stage) {
+    const millis_t ms = millis();
+    SERIAL_ECHO_START();
+    SERIAL_ECHOPGM("Boot ");
+    serialprintPGM(stage);
+    SERIAL_ECHOPAIR(": ", ms - boot_stage_ms);
+    SERIAL_ECHOLNPGM("ms");
+    boot_stage_ms = ms;
+  }
+  #define BOOT_STAGE(S) report_boot_stage(PSTR(S))
+
+#else
+
+  #define BOOT_STAGE(S) NOOP
+
+#endif
+
 /**
  * Standard idle routine keeps the machine alive
  */
@@ -536,6 +571,16 @@ void idle(
     max7219.idle_tasks();
   #endif
 
+  #if ENABLED(FAST_BOOT) && HAS_TRINAMIC && DISABLED(PS_DEFAULT_OFF)
+    // Deferred from setup() so the host can connect sooner
+    static bool tmc_tested; // = false
+    if (!tmc_tested) {
+      tmc_tested = true;
+      test_tmc_connection(true, true, true, true);
+      BOOT_STAGE("TMC test");
+    }
+  #endif
+
   ui.update();
 
   #if ENABLED(HOST_KEEPALIVE_FEATURE)
@@ -554,6 +599,18 @@ void idle(
     print_job_timer.tick();
   #endif
 
+  #if ENABLED(SDCARD_LOG_WRITE_BEHIND)
+    card.flush_log();
+  #endif
+
+  #if ENABLED(SDCARD_FILE_INDEX)
+    file_index.idle();
+  #endif
+
+  #if ENABLED(MESH_THERMAL_COMPENSATION)
+    mesh_thermal.update();
+  #endif
+
   #if HAS_BUZZER && DISABLED(LCD_USE_I2C_BUZZER)
     buzzer.tick();
   #endif
@@ -773,12 +830,16 @@ void setup() {
   SERIAL_ECHOPAIR(MSG_FREE_MEMORY, freeMemory());
   SERIAL_ECHOLNPAIR(MSG_PLANNER_BUFFER_BYTES, (int)sizeof(block_t)*BLOCK_BUFFER_SIZE);
 
+  BOOT_STAGE("serial");
+
   queue_setup();
 
   // Load data from EEPROM if available (or use defaults)
   // This also updates variables in the planner, elsewhere
   (void)settings.load();
 
+  BOOT_STAGE("settings");
+
   #if HAS_M206_COMMAND
     // Initialize current position based on home_offset
     COPY(current_position, home_offset);
@@ -877,6 +938,8 @@ void setup() {
     fanmux_init();
   #endif
 
+  BOOT_STAGE("hardware");
+
   #if defined(LULZBOT_STARTUP)
     LULZBOT_STARTUP
   #endif
@@ -888,6 +951,8 @@ void setup() {
     ui.show_bootscreen();
   #endif
 
+  BOOT_STAGE("LCD");
+
   #if ENABLED(MIXING_EXTRUDER)
     mixer.init();
   #endif
@@ -937,9 +1002,17 @@ void setup() {
     card.beginautostart();
   #endif
 
-  #if HAS_TRINAMIC && DISABLED(PS_DEFAULT_OFF)
+  #if HAS_TRINAMIC && DISABLED(PS_DEFAULT_OFF) && DISABLED(FAST_BOOT)
     test_tmc_connection(true, true, true, true);
   #endif
+
+  BOOT_STAGE("devices");
+
+  #if ENABLED(FAST_BOOT_REPORT)
+    SERIAL_ECHO_START();
+    SERIAL_ECHOPAIR("Boot complete: ", millis());
+    SERIAL_ECHOLNPGM("ms");
+  #endif
 }
 
 /**
@@ -980,6 +1053,10 @@ void loop() {
 
     if (commands_in_queue < BUFSIZE) get_available_commands();
     advance_command_queue();
+    #if ENABLED(PATH_BLENDING)
+      // Don't hold a move back while the planner runs dry
+      if (!commands_in_queue && planner.movesplanned() < 2) path_blending.flush();
+    #endif
     endstops.event_handler();
     idle();
   }
@@ -546,6 +546,14 @@
   // and processor overload (too many expensive sqrt calls).
   #define DELTA_SEGMENTS_PER_SECOND 200
 
+  // Take the square roots of the delta kinematics only every few segments
+  // and interpolate the towers in between, within DELTA_INTERPOLATION_ERROR.
+  // Allows a much higher DELTA_SEGMENTS_PER_SECOND on 8-bit boards.
+  //#define DELTA_INTERPOLATION
+  #if ENABLED(DELTA_INTERPOLATION)
+    #define DELTA_INTERPOLATION_ERROR 0.002 // (mm) Largest tower error between exact points
+  #endif
+
   // After homing move down to a height where XY movement is unconstrained
   //#define DELTA_HOME_TO_SAFE_ZONE
 
@@ -37,7 +37,7 @@ inline void serial_delay(const millis_t ms) {
   #endif
 }
 
-#if ENABLED(EEPROM_SETTINGS) || ENABLED(SD_FIRMWARE_UPDATE)
+#if ENABLED(EEPROM_SETTINGS) || ENABLED(SD_FIRMWARE_UPDATE) || ENABLED(POWER_LOSS_JOURNAL)
   void crc16(uint16_t *crc, const void * const data, uint16_t cnt);
 #endif
 
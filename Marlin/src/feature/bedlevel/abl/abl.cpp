@@ -33,6 +33,10 @@ int bilinear_grid_spacing[2], bilinear_start[2];
 float bilinear_grid_factor[2],
       z_values[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
 
+#if ENABLED(ADAPTIVE_PROBING)
+  uint8_t z_sigma[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y]; // Probe sample spread in microns, 0xFF if unknown
+#endif
+
 /**
  * Extrapolate a single point from its neighbors
  */
@@ -142,6 +146,17 @@ void print_bilinear_leveling_grid() {
   );
 }
 
+#if ENABLED(ADAPTIVE_PROBING)
+
+  void print_bilinear_sigma_grid() {
+    SERIAL_ECHOLNPGM("Probe Sigma Grid:");
+    print_2d_array(GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y, 3,
+      [](const uint8_t ix, const uint8_t iy) { return z_sigma[ix][iy] == 0xFF ? NAN : z_sigma[ix][iy] * 0.001f; }
+    );
+  }
+
+#endif
+
 #if ENABLED(ABL_BILINEAR_SUBDIVISION)
 
   #define ABL_GRID_POINTS_VIRT_X (GRID_MAX_POINTS_X - 1) * (BILINEAR_SUBDIVISIONS) + 1
@@ -30,6 +30,10 @@ float bilinear_z_offset(const float raw[XYZ]);
 
 void extrapolate_unprobed_bed_level();
 void print_bilinear_leveling_grid();
+#if ENABLED(ADAPTIVE_PROBING)
+  extern uint8_t z_sigma[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+  void print_bilinear_sigma_grid();
+#endif
 void refresh_bed_level();
 #if ENABLED(ABL_BILINEAR_SUBDIVISION)
   void print_bilinear_leveling_grid_virt();
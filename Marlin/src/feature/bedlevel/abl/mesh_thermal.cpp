@@ -0,0 +1,126 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016, 2017 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * mesh_thermal.cpp - Bed temperature compensation for the bilinear mesh
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(MESH_THERMAL_COMPENSATION)
+
+#include "mesh_thermal.h"
+#include "abl.h"
+#include "../bedlevel.h"
+
+#include "../../../module/planner.h"
+#include "../../../module/temperature.h"
+
+MeshThermal mesh_thermal;
+
+mesh_thermal_t MeshThermal::data;
+bool MeshThermal::calibrating; // = false
+
+#define COEFF_TO_MM  0.0001f  // 0.1µm per °C
+#define CALIB_NAN    -32768
+
+void MeshThermal::reset() {
+  calibrating = false;
+  data.temp = 0;
+  for (uint8_t x = 0; x < GRID_MAX_POINTS_X; x++)
+    for (uint8_t y = 0; y < GRID_MAX_POINTS_Y; y++)
+      data.coeff[x][y] = 0;
+}
+
+/**
+ * Shift the whole mesh by each point's coefficient
+ */
+void MeshThermal::apply(const float &dt) {
+  if (calibrating) return;
+  for (uint8_t x = 0; x < GRID_MAX_POINTS_X; x++)
+    for (uint8_t y = 0; y < GRID_MAX_POINTS_Y; y++)
+      if (!isnan(z_values[x][y])) z_values[x][y] += data.coeff[x][y] * (COEFF_TO_MM) * dt;
+  refresh_bed_level();
+}
+
+/**
+ * Called from idle() to follow the bed temperature.
+ * Only an active mesh is shifted, so G29 always sees raw data.
+ */
+void MeshThermal::update() {
+  static millis_t next_update_ms;
+  const millis_t ms = millis();
+  if (!ELAPSED(ms, next_update_ms)) return;
+  next_update_ms = ms + 1000UL;
+
+  if (calibrating || !planner.leveling_active) return;
+
+  const float temp = thermalManager.degBed(), dt = temp - data.temp;
+  if (ABS(dt) < MESH_THERMAL_RESOLUTION) return;
+
+  apply(dt);
+  data.temp = temp;
+}
+
+/**
+ * Calibration: park the current mesh in the coefficient array (in microns)
+ * so it can be compared with a mesh probed at another temperature.
+ * Leveling must be off until finish_calibration(). Until then the
+ * coefficients are not applied to the mesh.
+ */
+void MeshThermal::begin_calibration() {
+  calibrating = true;
+  for (uint8_t x = 0; x < GRID_MAX_POINTS_X; x++)
+    for (uint8_t y = 0; y < GRID_MAX_POINTS_Y; y++) {
+      const float z = z_values[x][y];
+      data.coeff[x][y] = isnan(z) ? CALIB_NAN : int16_t(constrain(LROUND(z * 1000), -32767, 32767));
+    }
+}
+
+/**
+ * Calibration: derive each coefficient from the parked mesh and the new mesh,
+ * which was probed at the current data.temp.
+ */
+bool MeshThermal::finish_calibration(const float &base_temp) {
+  calibrating = false;
+  const float dt = data.temp - base_temp;
+  if (ABS(dt) < 1) { reset(); return false; }
+
+  for (uint8_t x = 0; x < GRID_MAX_POINTS_X; x++)
+    for (uint8_t y = 0; y < GRID_MAX_POINTS_Y; y++) {
+      const float z = z_values[x][y];
+      const int16_t base = data.coeff[x][y];
+      data.coeff[x][y] = (isnan(z) || base == CALIB_NAN) ? 0
+        : int16_t(constrain(LROUND((z * 1000 - base) * 10 / dt), -32767, 32767));
+    }
+  return true;
+}
+
+void MeshThermal::report() {
+  SERIAL_ECHOPAIR("Mesh bed temperature: ", data.temp);
+  SERIAL_ECHOLNPGM("\nZ per degree (um/C):");
+  print_2d_array(GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y, 2,
+    [](const uint8_t ix, const uint8_t iy) { return data.coeff[ix][iy] * 0.1f; }
+  );
+}
+
+#endif // MESH_THERMAL_COMPENSATION
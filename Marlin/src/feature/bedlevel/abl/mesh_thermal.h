@@ -0,0 +1,61 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016, 2017 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * mesh_thermal.h - Bed temperature compensation for the bilinear mesh
+ *
+ * Each grid point has a linear coefficient for the change in Z per degree
+ * of bed temperature. The active mesh is kept shifted to the current bed
+ * temperature, so a mesh probed cold remains valid on a hot bed.
+ */
+
+#include "../../../inc/MarlinConfigPre.h"
+
+#pragma pack(push, 1) // No padding between fields
+
+typedef struct {
+  float temp;                                           // Bed temperature the active mesh applies to
+  int16_t coeff[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];  // Z change per °C in 0.1µm units
+} mesh_thermal_t;
+
+#pragma pack(pop)
+
+class MeshThermal {
+public:
+  static mesh_thermal_t data;
+  static bool calibrating;  // The coefficients hold the G76 baseline mesh
+
+  static void reset();
+  static void set_reference(const float &temp) { data.temp = temp; }
+  static void shift_to(const float &temp) { apply(temp - data.temp); data.temp = temp; }
+  static void update();
+  static void report();
+
+  static void begin_calibration();
+  static bool finish_calibration(const float &base_temp);
+
+private:
+  static void apply(const float &dt);
+};
+
+extern MeshThermal mesh_thermal;
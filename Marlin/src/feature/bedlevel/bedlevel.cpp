@@ -134,8 +134,12 @@ void reset_bed_level() {
     bilinear_start[X_AXIS] = bilinear_start[Y_AXIS] =
     bilinear_grid_spacing[X_AXIS] = bilinear_grid_spacing[Y_AXIS] = 0;
     for (uint8_t x = 0; x < GRID_MAX_POINTS_X; x++)
-      for (uint8_t y = 0; y < GRID_MAX_POINTS_Y; y++)
+      for (uint8_t y = 0; y < GRID_MAX_POINTS_Y; y++) {
         z_values[x][y] = NAN;
+        #if ENABLED(ADAPTIVE_PROBING)
+          z_sigma[x][y] = 0xFF;
+        #endif
+      }
   #elif ABL_PLANAR
     planner.bed_level_matrix.set_to_identity();
   #endif
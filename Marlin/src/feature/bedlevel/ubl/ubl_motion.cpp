@@ -64,6 +64,10 @@
               cell_dest_xi  = get_cell_index_x(end[X_AXIS]),
               cell_dest_yi  = get_cell_index_y(end[Y_AXIS]);
 
+    // All the cell crossings of this move go to the planner as one batch,
+    // ended after the final move.
+    planner.begin_batch();
+
     if (g26_debug_flag) {
       SERIAL_ECHOPAIR(" ubl.line_to_destination_cartesian(xe=", destination[X_AXIS]);
       SERIAL_ECHOPAIR(", ye=", destination[Y_AXIS]);
@@ -90,6 +94,7 @@
           #endif
         ;
         planner.buffer_segment(end[X_AXIS], end[Y_AXIS], end[Z_AXIS] + z_raise, end[E_AXIS], feed_rate, extruder);
+        planner.end_batch();
         set_current_from_destination();
 
         if (g26_debug_flag)
@@ -117,6 +122,7 @@
       // Undefined parts of the Mesh in z_values[][] are NAN.
       // Replace NAN corrections with 0.0 to prevent NAN propagation.
       planner.buffer_segment(end[X_AXIS], end[Y_AXIS], end[Z_AXIS] + (isnan(z0) ? 0.0 : z0), end[E_AXIS], feed_rate, extruder);
+      planner.end_batch();
 
       if (g26_debug_flag)
         debug_current_and_destination(PSTR("FINAL_MOVE in ubl.line_to_destination_cartesian()"));
@@ -130,6 +136,8 @@
      * case - crossing only one X or Y line - after details are worked out to reduce computation.
      */
 
+    const float fade_scaling_factor = planner.fade_scaling_factor_for_z(end[Z_AXIS]);
+
     const float dx = end[X_AXIS] - start[X_AXIS],
                 dy = end[Y_AXIS] - start[Y_AXIS];
 
@@ -186,7 +194,7 @@
         const float rx = inf_m_flag ? start[X_AXIS] : (next_mesh_line_y - c) / m;
 
         float z0 = z_correction_for_x_on_horizontal_mesh_line(rx, current_xi, current_yi)
-                   * planner.fade_scaling_factor_for_z(end[Z_AXIS]);
+                   * fade_scaling_factor;
 
         // Undefined parts of the Mesh in z_values[][] are NAN.
         // Replace NAN corrections with 0.0 to prevent NAN propagation.
@@ -221,6 +229,7 @@
       if (current_position[X_AXIS] != end[X_AXIS] || current_position[Y_AXIS] != end[Y_AXIS])
         goto FINAL_MOVE;
 
+      planner.end_batch();
       set_current_from_destination();
       return;
     }
@@ -237,7 +246,7 @@
                     ry = m * next_mesh_line_x + c;   // Calculate Y at the next X mesh line
 
         float z0 = z_correction_for_y_on_vertical_mesh_line(ry, current_xi, current_yi)
-                   * planner.fade_scaling_factor_for_z(end[Z_AXIS]);
+                   * fade_scaling_factor;
 
         // Undefined parts of the Mesh in z_values[][] are NAN.
         // Replace NAN corrections with 0.0 to prevent NAN propagation.
@@ -272,6 +281,7 @@
       if (current_position[X_AXIS] != end[X_AXIS] || current_position[Y_AXIS] != end[Y_AXIS])
         goto FINAL_MOVE;
 
+      planner.end_batch();
       set_current_from_destination();
       return;
     }
@@ -304,7 +314,7 @@
       if (left_flag == (rx > next_mesh_line_x)) { // Check if we hit the Y line first
         // Yes!  Crossing a Y Mesh Line next
         float z0 = z_correction_for_x_on_horizontal_mesh_line(rx, current_xi - left_flag, current_yi + dyi)
-                   * planner.fade_scaling_factor_for_z(end[Z_AXIS]);
+                   * fade_scaling_factor;
 
         // Undefined parts of the Mesh in z_values[][] are NAN.
         // Replace NAN corrections with 0.0 to prevent NAN propagation.
@@ -327,7 +337,7 @@
       else {
         // Yes!  Crossing a X Mesh Line next
         float z0 = z_correction_for_y_on_vertical_mesh_line(ry, current_xi + dxi, current_yi - down_flag)
-                   * planner.fade_scaling_factor_for_z(end[Z_AXIS]);
+                   * fade_scaling_factor;
 
         // Undefined parts of the Mesh in z_values[][] are NAN.
         // Replace NAN corrections with 0.0 to prevent NAN propagation.
@@ -358,6 +368,7 @@
     if (current_position[X_AXIS] != end[X_AXIS] || current_position[Y_AXIS] != end[Y_AXIS])
       goto FINAL_MOVE;
 
+    planner.end_batch();
     set_current_from_destination();
   }
 
@@ -378,6 +389,7 @@
   /**
    * Prepare a segmented linear move for DELTA/SCARA/CARTESIAN with UBL and FADE semantics.
    * This calls planner.buffer_segment multiple times for small incremental moves.
+   * The segments are queued as one planner batch to save a recalculate() per segment.
    * Returns true if did NOT move, false if moved (requires current_position update).
    */
 
@@ -429,6 +441,9 @@
       current_position[E_AXIS]
     };
 
+    // Queue all segments of the move as one planner batch
+    planner.begin_batch();
+
     // Only compute leveling per segment if ubl active and target below z_fade_height.
     if (!planner.leveling_active || !planner.leveling_active_at_z(rtarget[Z_AXIS])) {   // no mesh leveling
       while (--segments) {
@@ -444,6 +459,7 @@
           , inv_duration
         #endif
       );
+      planner.end_batch();
       return false; // moved but did not set_current_from_destination();
     }
 
@@ -526,8 +542,10 @@
         );
         raw[Z_AXIS] = z;
 
-        if (segments == 0)                        // done with last segment
+        if (segments == 0) {                      // done with last segment
+          planner.end_batch();
           return false;                           // did not set_current_from_destination()
+        }
 
         LOOP_XYZE(i) raw[i] += diff[i];
 
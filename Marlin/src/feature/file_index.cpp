@@ -0,0 +1,442 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * file_index.cpp - Layer, time and filament index of the selected SD file
+ *
+ * When a file is selected it is scanned from idle(), one block at a time,
+ * and the result is written to NAME.IDX beside it:
+ *
+ *  - A layer starts at the last Z change before an extruding XY move at
+ *    a new height, so Z-hops don't count as layers.
+ *
+ *  - Each G0/G1 move is timed as a trapezoid with the current acceleration
+ *    settings. Its entry and exit speeds come from the junctions with its
+ *    neighbours, as in the planner, but without the backward pass.
+ *
+ * A later selection of the same file (same size and first cluster) reads
+ * the header and skips the scan. While printing, progress and remaining
+ * time follow the estimated time instead of the byte count.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(SDCARD_FILE_INDEX)
+
+#include "file_index.h"
+
+FileIndex file_index;
+
+#include "../module/planner.h"
+#include "../core/serial.h"
+
+// Time (ms) spent parsing per call to idle()
+#define INDEX_IDLE_MS 1
+
+SdFile FileIndex::scan, FileIndex::sidecar;
+bool FileIndex::scanning, FileIndex::indexed;
+file_index_header_t FileIndex::header;
+
+uint8_t FileIndex::buffer[512];
+uint16_t FileIndex::buffer_len, FileIndex::buffer_pos;
+char FileIndex::line[96];
+uint8_t FileIndex::line_len;
+bool FileIndex::in_comment;
+uint32_t FileIndex::scan_pos, FileIndex::line_pos;
+
+float FileIndex::pos[XYZE], FileIndex::feedrate_mm_s, FileIndex::time_frac, FileIndex::filament_frac, FileIndex::last_layer_z;
+uint32_t FileIndex::filament_mm;
+bool FileIndex::relative_xyz, FileIndex::relative_e, FileIndex::have_mark;
+file_index_layer_t FileIndex::mark;
+
+bool FileIndex::have_move, FileIndex::move_xyz;
+float FileIndex::move_unit[XYZ], FileIndex::move_length, FileIndex::move_speed, FileIndex::move_accel, FileIndex::move_entry;
+
+uint16_t FileIndex::cursor;
+file_index_layer_t FileIndex::from, FileIndex::to;
+
+// Add to a running total kept as whole units plus a float fraction,
+// so small steps aren't lost once the total is large.
+static void accumulate(uint32_t &whole, float &frac, const float add) {
+  frac += add;
+  if (frac >= 1.0f) {
+    const uint32_t w = frac;
+    whole += w;
+    frac -= w;
+  }
+}
+
+/**
+ * Start indexing a file that was just opened for printing. If the
+ * sidecar already holds its index, use that instead.
+ */
+void FileIndex::select(SdFile &dir, const char * const name, const SdFile &source) {
+  stop();
+
+  // NAME.GCO -> NAME.IDX
+  char idx_name[13];
+  uint8_t i = 0;
+  while (name[i] && name[i] != '.' && i < 8) { idx_name[i] = name[i]; i++; }
+  const char * const ext = strchr(name, '.');
+  if (ext && !strcasecmp(ext + 1, "IDX")) return;
+  strcpy_P(&idx_name[i], PSTR(".IDX"));
+
+  if (!sidecar.open(&dir, idx_name, O_CREAT | O_RDWR)) return;
+
+  const uint32_t first_cluster = source.firstCluster();
+  if (sidecar.read(&header, sizeof(header)) == sizeof(header)
+    && header.version == FILE_INDEX_VERSION
+    && header.file_size == source.fileSize()
+    && header.first_cluster == first_cluster
+  ) {
+    indexed = true;
+    return;
+  }
+
+  // Start over with a header that marks the index incomplete
+  memset(&header, 0, sizeof(header));
+  header.file_size = source.fileSize();
+  header.first_cluster = first_cluster;
+  if (!sidecar.truncate(0) || sidecar.write(&header, sizeof(header)) != sizeof(header)) {
+    sidecar.close();
+    return;
+  }
+
+  scan = source;
+  scan.seekSet(0);
+  buffer_len = buffer_pos = 0;
+  line_len = 0;
+  in_comment = false;
+  scan_pos = line_pos = 0;
+
+  ZERO(pos);
+  feedrate_mm_s = 25;
+  time_frac = filament_frac = 0;
+  filament_mm = 0;
+  last_layer_z = -1;
+  relative_xyz = relative_e = have_mark = have_move = false;
+
+  scanning = true;
+}
+
+void FileIndex::stop() {
+  scanning = indexed = false;
+  if (sidecar.isOpen()) sidecar.close();
+  cursor = 0;
+  memset(&from, 0, sizeof(from));
+  memset(&to, 0, sizeof(to));
+}
+
+/**
+ * Parse lines of the file being indexed for up to INDEX_IDLE_MS
+ */
+void FileIndex::idle() {
+  if (!scanning) return;
+
+  const millis_t end_ms = millis() + (INDEX_IDLE_MS);
+  for (;;) {
+    if (buffer_pos >= buffer_len) {
+      if (ELAPSED(millis(), end_ms)) return;
+      const int16_t n = scan.read(buffer, sizeof(buffer));
+      if (n <= 0) {
+        if (line_len) parse_line();
+        finish_scan();
+        return;
+      }
+      buffer_len = n;
+      buffer_pos = 0;
+    }
+
+    const char c = buffer[buffer_pos++];
+    scan_pos++;
+    if (c == '\n' || c == '\r') {
+      const bool parsed = line_len;
+      if (parsed) parse_line();
+      line_len = 0;
+      in_comment = false;
+      line_pos = scan_pos;
+      if (parsed && ELAPSED(millis(), end_ms)) return;
+    }
+    else if (c == ';' || c == '(')
+      in_comment = true;
+    else if (!in_comment && line_len < sizeof(line) - 1)
+      line[line_len++] = c;
+  }
+}
+
+/**
+ * Simulate one line: motion, positioning modes and dwells
+ */
+void FileIndex::parse_line() {
+  line[line_len] = '\0';
+
+  char *p = line;
+  while (*p == ' ') p++;
+  if (*p == 'N' || *p == 'n') {               // Skip a line number
+    while (*p && *p != ' ') p++;
+    while (*p == ' ') p++;
+  }
+
+  const char letter = toupper(*p);
+  if (letter != 'G' && letter != 'M') return;
+  const int code = strtol(p + 1, &p, 10);
+  if (*p == '.') return;                      // Subcodes (e.g., G92.1) don't move
+
+  // Collect the parameters that matter here
+  static const char axes[] PROGMEM = "XYZEFPS";
+  float value[7];
+  uint8_t seen = 0;
+  while (*p) {
+    PGM_P const a = strchr_P(axes, toupper(*p));
+    if (a) {
+      const uint8_t i = a - axes;
+      value[i] = strtod(p + 1, &p);
+      SBI(seen, i);
+    }
+    else
+      p++;
+  }
+  #define SEEN(I) TEST(seen, I)
+
+  if (letter == 'M') {
+    if (code == 82) relative_e = false;
+    else if (code == 83) relative_e = true;
+    return;
+  }
+
+  switch (code) {
+    case 0: case 1: case 2: case 3: {         // Arcs are timed as their chord
+      if (SEEN(4)) feedrate_mm_s = value[4] * (1.0f / 60.0f);
+      float dest[XYZE];
+      LOOP_XYZE(i) {
+        dest[i] = pos[i];
+        if (SEEN(i)) dest[i] = (i == E_AXIS ? relative_e : relative_xyz) ? pos[i] + value[i] : value[i];
+      }
+      if (dest[Z_AXIS] != pos[Z_AXIS]) {
+        // Remember where the height changed. It's a layer start if extrusion follows.
+        mark.offset = line_pos;
+        mark.time = header.time;
+        mark.z = dest[Z_AXIS];
+        mark.e = pos[E_AXIS];
+        mark.filament = filament_mm + filament_frac;
+        have_mark = true;
+      }
+      const bool extruding = dest[E_AXIS] > pos[E_AXIS] && (dest[X_AXIS] != pos[X_AXIS] || dest[Y_AXIS] != pos[Y_AXIS]);
+      if (extruding && have_mark && ABS(dest[Z_AXIS] - last_layer_z) > 0.0001f) {
+        if (sidecar.write(&mark, sizeof(mark)) == sizeof(mark)) header.layers++;
+        last_layer_z = dest[Z_AXIS];
+        have_mark = false;
+      }
+      add_move(dest);
+      COPY(pos, dest);
+    } break;
+
+    case 4:                                   // Dwell ends the lookahead
+      finish_move(0);
+      if (SEEN(6)) accumulate(header.time, time_frac, value[6]);
+      else if (SEEN(5)) accumulate(header.time, time_frac, value[5] * 0.001f);
+      break;
+
+    case 28:                                  // Homing leaves the position unknown
+      finish_move(0);
+      LOOP_XYZ(i) if (SEEN(i) || !(SEEN(0) || SEEN(1) || SEEN(2))) pos[i] = 0;
+      break;
+
+    case 90: relative_xyz = relative_e = false; break;
+    case 91: relative_xyz = relative_e = true; break;
+
+    case 92:                                  // Without axes G92 does nothing
+      LOOP_XYZE(i) if (SEEN(i)) pos[i] = value[i];
+      break;
+  }
+}
+
+/**
+ * Hold a move until the next one gives it an exit speed, and
+ * time the move held before it.
+ */
+void FileIndex::add_move(const float (&dest)[XYZE]) {
+  float delta[XYZE];
+  LOOP_XYZE(i) delta[i] = dest[i] - pos[i];
+
+  // Count all E moves, so retractions cancel their primes
+  accumulate(filament_mm, filament_frac, delta[E_AXIS]);
+
+  const bool xyz = delta[X_AXIS] || delta[Y_AXIS] || delta[Z_AXIS];
+  float length, speed = MAX(feedrate_mm_s, 0.1f), accel;
+  if (xyz) {
+    length = SQRT(sq(delta[X_AXIS]) + sq(delta[Y_AXIS]) + sq(delta[Z_AXIS]));
+    accel = delta[E_AXIS] ? planner.settings.acceleration : planner.settings.travel_acceleration;
+    // Each axis keeps to its own limits, as in the planner
+    LOOP_XYZ(i) if (delta[i]) {
+      const float scale = length / ABS(delta[i]);
+      NOMORE(speed, planner.settings.max_feedrate_mm_s[i] * scale);
+      NOMORE(accel, planner.settings.max_acceleration_mm_per_s2[i] * scale);
+    }
+  }
+  else if (delta[E_AXIS]) {
+    length = ABS(delta[E_AXIS]);
+    NOMORE(speed, planner.settings.max_feedrate_mm_s[E_AXIS]);
+    accel = planner.settings.retract_acceleration;
+  }
+  else
+    return;
+  NOLESS(accel, 1.0f);
+
+  float unit[XYZ] = { 0 }, junction = 0;
+  if (xyz) {
+    LOOP_XYZ(i) unit[i] = delta[i] / length;
+    if (have_move && move_xyz) {
+      const float cos_theta = -(move_unit[X_AXIS] * unit[X_AXIS] + move_unit[Y_AXIS] * unit[Y_AXIS] + move_unit[Z_AXIS] * unit[Z_AXIS]);
+      #if ENABLED(JUNCTION_DEVIATION)
+        // Fastest speed that stays within the junction deviation of the corner
+        if (cos_theta < -0.999999f)
+          junction = speed;
+        else if (cos_theta < 0.999999f) {
+          const float sin_theta_d2 = SQRT(0.5f * (1.0f - cos_theta));
+          junction = SQRT(MIN(move_accel, accel) * planner.junction_deviation_mm * sin_theta_d2 / (1.0f - sin_theta_d2));
+        }
+      #else
+        // Fastest speed that turns the corner within the X jerk
+        const float sin_half = SQRT(0.5f * (1.0f + cos_theta));
+        junction = sin_half > 0.001f ? planner.max_jerk[X_AXIS] * 0.5f / sin_half : speed;
+      #endif
+      NOMORE(junction, MIN(move_speed, speed));
+    }
+  }
+
+  finish_move(junction);
+
+  have_move = true;
+  move_xyz = xyz;
+  COPY(move_unit, unit);
+  move_length = length;
+  move_speed = speed;
+  move_accel = accel;
+  move_entry = junction;
+}
+
+/**
+ * Time the held move as a trapezoid between its entry and exit speeds
+ */
+void FileIndex::finish_move(const float exit_speed) {
+  if (!have_move) return;
+  have_move = false;
+
+  const float v = move_speed, a = move_accel, d = move_length,
+              vi = MIN(move_entry, v), vo = MIN(exit_speed, v),
+              accel_dist = (sq(v) - sq(vi)) / (2 * a),
+              decel_dist = (sq(v) - sq(vo)) / (2 * a);
+  float t;
+  if (accel_dist + decel_dist <= d)
+    t = (2 * v - vi - vo) / a + (d - accel_dist - decel_dist) / v;
+  else {
+    // Too short to reach full speed
+    const float peak = SQRT(a * d + 0.5f * (sq(vi) + sq(vo)));
+    if (peak > MAX(vi, vo))
+      t = (2 * peak - vi - vo) / a;
+    else                                      // The planner would lower one of the ends
+      t = 2 * d / (vi + vo);
+  }
+  accumulate(header.time, time_frac, t);
+}
+
+/**
+ * Write the header that makes the sidecar valid
+ */
+void FileIndex::finish_scan() {
+  scanning = false;
+  finish_move(0);
+  header.version = FILE_INDEX_VERSION;
+  header.filament = filament_mm + filament_frac;
+  if (!sidecar.seekSet(0) || sidecar.write(&header, sizeof(header)) != sizeof(header) || !sidecar.sync()) {
+    sidecar.close();
+    return;
+  }
+  indexed = true;
+  SERIAL_ECHO_START();
+  SERIAL_ECHOPAIR("File indexed: ", header.layers);
+  SERIAL_ECHOPAIR(" layers, ", header.time);
+  SERIAL_ECHOPAIR("s, ", int(header.filament));
+  SERIAL_ECHOLNPGM("mm filament");
+}
+
+bool FileIndex::read_layer(const uint16_t n, file_index_layer_t &rec) {
+  return sidecar.seekSet(sizeof(header) + uint32_t(n) * sizeof(rec))
+      && sidecar.read(&rec, sizeof(rec)) == sizeof(rec);
+}
+
+/**
+ * Get a layer record, e.g. to restart a failed print at that layer
+ */
+bool FileIndex::layer(const uint16_t n, file_index_layer_t &rec) {
+  return indexed && n < header.layers && read_layer(n, rec);
+}
+
+/**
+ * Estimated seconds to reach a file position. The records on either
+ * side of it are kept, so printing reads one record per layer.
+ */
+uint32_t FileIndex::estimated_elapsed(const uint32_t sdpos) {
+  if (sdpos < from.offset || !cursor) {
+    // Back to the start, e.g. after M26
+    memset(&from, 0, sizeof(from));
+    if (!header.layers || !read_layer(0, to)) { to.offset = header.file_size; to.time = header.time; }
+    cursor = 1;
+  }
+  while (sdpos >= to.offset && to.offset < header.file_size) {
+    from = to;
+    if (cursor < header.layers && read_layer(cursor, to))
+      cursor++;
+    else {
+      to.offset = header.file_size;
+      to.time = header.time;
+    }
+  }
+  if (to.offset <= from.offset) return from.time;
+  return from.time + uint32_t(float(to.time - from.time) * (sdpos - from.offset) / (to.offset - from.offset));
+}
+
+uint8_t FileIndex::percent_done(const uint32_t sdpos) {
+  return header.time ? MIN(estimated_elapsed(sdpos) * 100UL / header.time, 100UL) : 0;
+}
+
+/**
+ * The layer holding a file position, counting from 1
+ */
+uint16_t FileIndex::current_layer(const uint32_t sdpos) {
+  estimated_elapsed(sdpos);
+  return (to.offset >= header.file_size) ? header.layers : cursor - 1;
+}
+
+/**
+ * Seconds left at a file position. Once a minute has passed the estimate
+ * is scaled by the real time taken so far, which covers speed changes and
+ * what the model leaves out.
+ */
+uint32_t FileIndex::remaining(const uint32_t sdpos, const uint32_t elapsed) {
+  const uint32_t done = estimated_elapsed(sdpos), left = header.time > done ? header.time - done : 0;
+  if (done < 60 || elapsed < 60) return left;
+  return left * constrain(float(elapsed) / done, 0.25f, 4.0f);
+}
+
+#endif // SDCARD_FILE_INDEX
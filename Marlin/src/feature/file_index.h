@@ -0,0 +1,101 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * file_index.h - Layer, time and filament index of the selected SD file
+ */
+
+#include "../inc/MarlinConfigPre.h"
+#include "../sd/SdFile.h"
+
+#define FILE_INDEX_VERSION 1
+
+// One record per layer in the sidecar file
+typedef struct {
+  uint32_t offset,        // File position of the line that moved to the layer
+           time;          // Estimated seconds from the start of the file
+  float z,                // Layer height
+        e,                // E coordinate in the file at the layer start
+        filament;         // Filament (mm) used before the layer
+} file_index_layer_t;
+
+// Sidecar header, written once the scan is complete
+typedef struct {
+  uint16_t version;
+  uint16_t layers;
+  uint32_t file_size,     // Identify the indexed file
+           first_cluster,
+           time;          // Estimated seconds for the whole file
+  float filament;         // Filament (mm) for the whole file
+} file_index_header_t;
+
+class FileIndex {
+private:
+  static SdFile scan, sidecar;
+  static bool scanning, indexed;
+  static file_index_header_t header;
+
+  // Scan state
+  static uint8_t buffer[512];
+  static uint16_t buffer_len, buffer_pos;
+  static char line[96];
+  static uint8_t line_len;
+  static bool in_comment;
+  static uint32_t scan_pos, line_pos;
+
+  // Simulated machine state
+  static float pos[XYZE], feedrate_mm_s, time_frac, filament_frac, last_layer_z;
+  static uint32_t filament_mm;      // Whole mm of filament, header.time holds whole seconds
+  static bool relative_xyz, relative_e, have_mark;
+  static file_index_layer_t mark;   // The last Z change, a layer start if extrusion follows
+
+  // The last move, held until the next one sets its exit speed
+  static bool have_move, move_xyz;
+  static float move_unit[XYZ], move_length, move_speed, move_accel, move_entry;
+
+  // Playback cursor
+  static uint16_t cursor;           // Next record to load
+  static file_index_layer_t from, to;
+
+  static void parse_line();
+  static void add_move(const float (&dest)[XYZE]);
+  static void finish_move(const float exit_speed);
+  static void finish_scan();
+  static bool read_layer(const uint16_t n, file_index_layer_t &rec);
+  static uint32_t estimated_elapsed(const uint32_t sdpos);
+
+public:
+  FORCE_INLINE static bool ready() { return indexed; }
+  FORCE_INLINE static uint16_t layer_count() { return header.layers; }
+
+  static void select(SdFile &dir, const char * const name, const SdFile &source);
+  static void stop();
+  static void idle();
+
+  static uint8_t percent_done(const uint32_t sdpos);
+  static uint16_t current_layer(const uint32_t sdpos);
+  static uint32_t remaining(const uint32_t sdpos, const uint32_t elapsed);
+  static bool layer(const uint16_t n, file_index_layer_t &rec);
+};
+
+extern FileIndex file_index;
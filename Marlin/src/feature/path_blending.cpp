@@ -0,0 +1,204 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * path_blending.cpp - Merge and blend short G0/G1 segments before planning
+ *
+ * Finely tessellated models produce long runs of tiny segments, and
+ * each one is a junction the planner has to slow down for. Here each
+ * G0/G1 move in the XY plane is held back until the next one arrives:
+ *
+ *  - If the joint and all points merged before it lie within the merge
+ *    tolerance of the combined move, with the same feedrate and flow,
+ *    the new move is merged into the held one.
+ *
+ *  - Otherwise the corner between them is cut with a short chord no
+ *    further than the blend tolerance from the corner, so the planner
+ *    sees two gentler corners. The held move is queued up to the chord,
+ *    and the rest of the new move is held in its place.
+ *
+ * Any other command queues the held move first, so the order of moves
+ * and other actions is kept.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(PATH_BLENDING)
+
+#include "path_blending.h"
+
+PathBlending path_blending; // Single instance - this calls the constructor
+
+#include "../module/motion.h"
+#include "../gcode/parser.h"
+
+// Largest change of filament flow between merged moves
+#define MERGE_FLOW_TOLERANCE 0.05f
+
+// Corners turning less than this (sine of half the angle) aren't worth a block
+#define BLEND_MIN_SIN_HALF 0.05f
+
+// Nor are cuts shorter than this on each side of the corner
+#define BLEND_MIN_MM 0.02f
+
+// private:
+
+bool PathBlending::held;
+uint8_t PathBlending::merged;
+float PathBlending::start[XYZE], PathBlending::end[XYZE],
+      PathBlending::fr_mm_s,
+      PathBlending::points[PATH_MERGE_POINTS][2];
+
+// public:
+
+bool PathBlending::enabled;
+float PathBlending::blend_tolerance,
+      PathBlending::merge_tolerance;
+
+void PathBlending::reset() {
+  held = false;
+  enabled = true;
+  blend_tolerance = PATH_BLEND_TOLERANCE;
+  merge_tolerance = PATH_MERGE_TOLERANCE;
+}
+
+/**
+ * Merge the move to destination into the held move, if the joint and the
+ * points merged before stay within merge_tolerance of the combined move.
+ */
+bool PathBlending::merge_move() {
+  if (merged >= PATH_MERGE_POINTS || fr_mm_s != feedrate_mm_s) return false;
+
+  // Same filament per mm on both, or both dry
+  const float len_a = HYPOT(end[X_AXIS] - start[X_AXIS], end[Y_AXIS] - start[Y_AXIS]),
+              len_b = HYPOT(destination[X_AXIS] - end[X_AXIS], destination[Y_AXIS] - end[Y_AXIS]),
+              e_a = end[E_AXIS] - start[E_AXIS],
+              e_b = destination[E_AXIS] - end[E_AXIS];
+  if (ABS(e_a * len_b - e_b * len_a) > (MERGE_FLOW_TOLERANCE) * ABS(e_a) * len_b) return false;
+
+  // Every point must project inside the chord and lie close enough to it
+  const float cx = destination[X_AXIS] - start[X_AXIS],
+              cy = destination[Y_AXIS] - start[Y_AXIS],
+              chord_sq = sq(cx) + sq(cy),
+              limit = sq(merge_tolerance) * chord_sq;
+
+  points[merged][0] = end[X_AXIS];
+  points[merged][1] = end[Y_AXIS];
+  for (uint8_t i = 0; i <= merged; i++) {
+    const float px = points[i][0] - start[X_AXIS],
+                py = points[i][1] - start[Y_AXIS],
+                dot = px * cx + py * cy;
+    if (dot <= 0 || dot >= chord_sq || sq(px * cy - py * cx) > limit) return false;
+  }
+
+  merged++;
+  COPY(end, destination);
+  return true;
+}
+
+/**
+ * Cut the corner between the held move and the move to destination.
+ * The held move is queued up to the cut, followed by the cut itself,
+ * and 'from' is set to where the rest of the new move starts.
+ *
+ * Both ends of the cut are d from the corner, which puts the cut
+ * d * sin(turn / 2) from the corner.
+ */
+void PathBlending::blend_corner(float (&from)[XYZE]) {
+  const float ax = end[X_AXIS] - start[X_AXIS], ay = end[Y_AXIS] - start[Y_AXIS],
+              bx = destination[X_AXIS] - end[X_AXIS], by = destination[Y_AXIS] - end[Y_AXIS],
+              len_a = HYPOT(ax, ay), len_b = HYPOT(bx, by);
+
+  // Don't blend extrusion with travel
+  if ((end[E_AXIS] > start[E_AXIS]) != (destination[E_AXIS] > end[E_AXIS])) return;
+
+  const float sin_half_sq = 0.5f * (1 - (ax * bx + ay * by) / (len_a * len_b));
+  if (sin_half_sq < sq(BLEND_MIN_SIN_HALF)) return;
+
+  const float d = MIN(blend_tolerance / SQRT(sin_half_sq), 0.5f * len_a, 0.5f * len_b);
+  if (d < BLEND_MIN_MM) return;
+
+  const float ra = d / len_a, rb = d / len_b;
+  float cut[XYZE];
+  LOOP_XYZE(i) {
+    cut[i] = end[i] - ra * (end[i] - start[i]);
+    from[i] = end[i] + rb * (destination[i] - end[i]);
+  }
+
+  COPY(end, cut);
+  flush();
+  prepare_held_move(cut, from, feedrate_mm_s);
+}
+
+/**
+ * Called by prepare_move_to_destination. Hold back a G0/G1 move in the
+ * XY plane, merging or blending it with the move held before.
+ *
+ * Returns true if the move was held and current_position[] was set to
+ * destination[]. Other moves are left to the caller, after the held
+ * move has been queued.
+ */
+bool PathBlending::hold_move() {
+  if (!enabled || parser.command_letter != 'G' || parser.codenum > 1
+    || destination[Z_AXIS] != current_position[Z_AXIS]
+    || (destination[X_AXIS] == current_position[X_AXIS] && destination[Y_AXIS] == current_position[Y_AXIS])
+  ) {
+    flush();
+    return false;
+  }
+
+  float from[XYZE];
+  COPY(from, current_position);
+
+  if (held) {
+    // Only join moves that meet
+    bool joined = true;
+    LOOP_XYZE(i) if (end[i] != current_position[i]) joined = false;
+
+    if (joined && merge_move()) {
+      set_current_from_destination();
+      return true;
+    }
+
+    if (joined && blend_tolerance > 0) blend_corner(from);
+    flush();
+  }
+
+  held = true;
+  merged = 0;
+  COPY(start, from);
+  COPY(end, destination);
+  fr_mm_s = feedrate_mm_s;
+  set_current_from_destination();
+  return true;
+}
+
+/**
+ * Queue the held move, if any
+ */
+void PathBlending::flush() {
+  if (!held) return;
+  held = false;
+  prepare_held_move(start, end, fr_mm_s);
+}
+
+#endif // PATH_BLENDING
@@ -0,0 +1,57 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * path_blending.h - Merge and blend short G0/G1 segments before planning
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+class PathBlending {
+private:
+  static bool held;                                 // A move is being held back
+  static uint8_t merged;                            // Points merged into the held move
+  static float start[XYZE], end[XYZE],              // The held move
+               fr_mm_s,                             // and its feedrate
+               points[PATH_MERGE_POINTS][2];        // XY of the points merged into it
+
+  static bool merge_move();
+  static void blend_corner(float (&from)[XYZE]);
+
+public:
+  static bool enabled;                              // G64 / G61
+  static float blend_tolerance,                     // G64 P - Largest distance from a corner to its blend
+               merge_tolerance;                     // G64 Q - Largest distance from a merged point to the move
+
+  PathBlending() { reset(); }
+
+  static void reset();
+
+  // Drop the held move, e.g. after a quick stop
+  FORCE_INLINE static void discard() { held = false; }
+
+  static bool hold_move();
+  static void flush();
+};
+
+extern PathBlending path_blending;
@@ -42,6 +42,7 @@ job_recovery_info_t PrintJobRecovery::info;
 #include "../gcode/gcode.h"
 #include "../module/motion.h"
 #include "../module/planner.h"
+#include "../module/stepper.h"
 #include "../module/printcounter.h"
 #include "../module/temperature.h"
 #include "../core/serial.h"
@@ -52,6 +53,17 @@ job_recovery_info_t PrintJobRecovery::info;
 
 PrintJobRecovery recovery;
 
+#if ENABLED(POWER_LOSS_EXACT_RESUME)
+  float PrintJobRecovery::planned_z; // Planner Z at the last save
+#endif
+
+#if ENABLED(POWER_LOSS_JOURNAL)
+  uint32_t PrintJobRecovery::journal_block, // = 0
+           PrintJobRecovery::journal_seq;   // = 0
+  uint8_t PrintJobRecovery::journal_slot;   // = 0
+  bool PrintJobRecovery::journal_used;      // = false
+#endif
+
 /**
  * Clear the recovery info
  */
@@ -105,11 +117,15 @@ void PrintJobRecovery::purge() {
  * Load the recovery data, if it exists
  */
 void PrintJobRecovery::load() {
-  if (exists()) {
-    open(true);
-    (void)file.read(&info, sizeof(info));
-    close();
-  }
+  #if ENABLED(POWER_LOSS_JOURNAL)
+    journal_read();
+  #else
+    if (exists()) {
+      open(true);
+      (void)file.read(&info, sizeof(info));
+      close();
+    }
+  #endif
   #if ENABLED(DEBUG_POWER_LOSS_RECOVERY)
     debug(PSTR("Load"));
   #endif
@@ -134,7 +150,13 @@ void PrintJobRecovery::save(const bool force/*=false*/, const bool save_queue/*=
         || ELAPSED(ms, next_save_ms)
       #endif
       // Save every time Z is higher than the last call
-      || current_position[Z_AXIS] > info.current_position[Z_AXIS]
+      || current_position[Z_AXIS] > (
+        #if ENABLED(POWER_LOSS_EXACT_RESUME)
+          planned_z   // The saved Z is where the steppers are, so it lags behind
+        #else
+          info.current_position[Z_AXIS]
+        #endif
+      )
     #endif
   ) {
 
@@ -193,6 +215,11 @@ void PrintJobRecovery::save(const bool force/*=false*/, const bool save_queue/*=
     card.getAbsFilename(info.sd_filename);
     info.sdpos = card.getIndex();
 
+    #if ENABLED(POWER_LOSS_EXACT_RESUME)
+      planned_z = current_position[Z_AXIS];
+      save_executed_move();
+    #endif
+
     write();
 
     // KILL now if the power-loss pin was triggered
@@ -202,6 +229,75 @@ void PrintJobRecovery::save(const bool force/*=false*/, const bool save_queue/*=
   }
 }
 
+#if ENABLED(POWER_LOSS_EXACT_RESUME)
+
+  /**
+   * Point the saved state at the G-code line the steppers are running and the
+   * position they have reached along it, so resume restarts that exact move.
+   * The feedrate is the one in effect for that line, not for the lines read
+   * ahead of it, so a restarted line without an F word runs at its own speed.
+   *
+   * The queue copy and planner position saved above are kept when the line
+   * can't be restarted part way: moves not from the SD file, anything but
+   * G0/G1 (e.g., arcs, which are relative to their start), or moves made in
+   * relative mode. The mode of each line is marked when it is processed.
+   *
+   * E is taken from the planner, not the E stepper, whose count includes
+   * flow, volumetric and LIN_ADVANCE factors that the file doesn't know.
+   */
+  void PrintJobRecovery::save_executed_move() {
+    uint32_t line;
+    uint16_t feedrate;
+    float pos[XYZE];
+
+    // Hold the stepper ISR so the block, its progress and the position agree
+    const bool was_enabled = STEPPER_ISR_ENABLED();
+    if (was_enabled) DISABLE_STEPPER_DRIVER_INTERRUPT();
+
+    const bool moving = planner.block_buffer_tail != planner.block_buffer_head;
+    if (moving) {
+      const block_t * const block = &planner.block_buffer[planner.block_buffer_tail];
+      line = block->sdpos;
+      feedrate = block->feedrate;
+      pos[E_AXIS] = block->e_start + (block->e_end - block->e_start) * stepper.block_progress(block);
+    }
+    else {
+      // Nothing is moving, so the next command can start from here, in the current modes
+      line = commands_in_queue > 1 ? command_sdpos[(cmd_queue_index_r + 1) % BUFSIZE] : card.getIndex();
+      if (line != SDPOS_NONE) {
+        line &= ~SDPOS_NO_RESTART;
+        if (relative_mode) line |= SDPOS_NO_RESTART;
+        LOOP_XYZE(i) if (gcode.axis_relative_modes[i]) line |= SDPOS_NO_RESTART;
+      }
+      feedrate = info.feedrate;
+      pos[E_AXIS] = 0;
+    }
+    get_cartesian_from_steppers();
+    COPY(pos, cartes);
+
+    if (was_enabled) ENABLE_STEPPER_DRIVER_INTERRUPT();
+
+    if (line & SDPOS_NO_RESTART) return; // Also SDPOS_NONE
+
+    #if HAS_POSITION_MODIFIERS
+      planner.unapply_modifiers(pos
+        #if HAS_LEVELING
+          , true
+        #endif
+      );
+    #endif
+
+    // With nothing queued, E is already at current_position
+    if (!moving) pos[E_AXIS] = current_position[E_AXIS];
+
+    COPY(info.current_position, pos);
+    info.feedrate = feedrate;
+    info.sdpos = line;
+    info.commands_in_queue = 0; // The file is read again from the restarted line
+  }
+
+#endif // POWER_LOSS_EXACT_RESUME
+
 /**
  * Save the recovery info the recovery file
  */
@@ -211,16 +307,146 @@ void PrintJobRecovery::write() {
     debug(PSTR("Write"));
   #endif
 
-  open(false);
-  file.seekSet(0);
-  const int16_t ret = file.write(&info, sizeof(info));
+  #if ENABLED(POWER_LOSS_JOURNAL)
+    const bool ok = journal_write();
+  #else
+    open(false);
+    file.seekSet(0);
+    const bool ok = file.write(&info, sizeof(info)) != -1;
+  #endif
   #if ENABLED(DEBUG_POWER_LOSS_RECOVERY)
-    if (ret == -1) SERIAL_ECHOLNPGM("Power-loss file write failed.");
+    if (!ok) SERIAL_ECHOLNPGM("Power-loss file write failed.");
   #else
-    UNUSED(ret);
+    UNUSED(ok);
   #endif
 }
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+
+  /**
+   * The journal is a contiguous file holding a ring of POWER_LOSS_JOURNAL_RECORDS
+   * records. Each save writes the next slot with raw block writes, so there's no
+   * FAT or directory update while printing. A save interrupted by power-loss
+   * leaves a bad CRC in its slot and the previous record is used instead.
+   */
+
+  typedef struct { void *data; uint16_t size; } journal_part_t;
+
+  inline uint32_t slot_block(const uint8_t slot) {
+    return recovery.journal_block + uint32_t(slot) * (JOURNAL_RECORD_BLOCKS);
+  }
+
+  inline uint16_t journal_crc(const uint32_t &seq) {
+    uint16_t crc = 0;
+    crc16(&crc, &seq, sizeof(seq));
+    crc16(&crc, &recovery.info, sizeof(recovery.info));
+    return crc;
+  }
+
+  /**
+   * Copy one record between its parts and the card, a block at a time.
+   * The volume cache is used as the block buffer, so it's cleared first.
+   */
+  static bool journal_transfer(uint32_t block, const journal_part_t (&parts)[3], const bool writing) {
+    cache_t * const cache = card.getVolume().cacheClear();
+    if (!cache) return false;
+    uint8_t p = 0;
+    uint16_t done = 0;
+    for (uint8_t b = 0; b < JOURNAL_RECORD_BLOCKS; b++, block++) {
+      if (!writing && !card.getSd2Card().readBlock(block, cache->data)) return false;
+      uint16_t n = 0;
+      while (n < 512 && p < COUNT(parts)) {
+        const uint16_t len = MIN(512 - n, parts[p].size - done);
+        uint8_t * const data = (uint8_t*)parts[p].data + done;
+        if (writing) memcpy(&cache->data[n], data, len); else memcpy(data, &cache->data[n], len);
+        n += len;
+        done += len;
+        if (done == parts[p].size) { p++; done = 0; }
+      }
+      if (writing) {
+        memset(&cache->data[n], 0, 512 - n);
+        if (!card.getSd2Card().writeBlock(block, cache->data)) return false;
+      }
+    }
+    return true;
+  }
+
+  // Zero every slot so no earlier record can be picked up
+  static bool journal_erase() {
+    cache_t * const cache = card.getVolume().cacheClear();
+    if (!cache) return false;
+    memset(cache->data, 0, sizeof(cache->data));
+    for (uint16_t b = 0; b < uint16_t(POWER_LOSS_JOURNAL_RECORDS) * (JOURNAL_RECORD_BLOCKS); b++)
+      if (!card.getSd2Card().writeBlock(recovery.journal_block + b, cache->data)) return false;
+    return true;
+  }
+
+  // Read a slot into info. Return true if it holds a good record.
+  static bool journal_read_slot(const uint8_t slot, uint32_t &seq) {
+    uint16_t crc;
+    const journal_part_t parts[] = { { &seq, sizeof(seq) }, { &recovery.info, sizeof(recovery.info) }, { &crc, sizeof(crc) } };
+    return journal_transfer(slot_block(slot), parts, false) && seq && crc == journal_crc(seq);
+  }
+
+  /**
+   * Find the journal file, creating and clearing it on first use.
+   * A journal that was already on the card may hold records until it's read.
+   */
+  bool PrintJobRecovery::journal_open() {
+    if (!journal_block) {
+      bool created;
+      journal_block = card.jobJournalBlock(JOURNAL_FILE_SIZE, created);
+      if (journal_block) journal_used = !(created && journal_erase());
+    }
+    return journal_block != 0;
+  }
+
+  /**
+   * Clear the journal records. The file stays allocated for the next print.
+   * Skip the block writes if no slot can hold a record.
+   */
+  void PrintJobRecovery::journal_clear() {
+    journal_seq = journal_slot = 0;
+    if (journal_open() && journal_used && journal_erase()) journal_used = false;
+  }
+
+  /**
+   * Append info to the ring as the next record
+   */
+  bool PrintJobRecovery::journal_write() {
+    if (!journal_open()) return false;
+    uint32_t seq = ++journal_seq;
+    uint16_t crc = journal_crc(seq);
+    const journal_part_t parts[] = { { &seq, sizeof(seq) }, { &info, sizeof(info) }, { &crc, sizeof(crc) } };
+    const bool ok = journal_transfer(slot_block(journal_slot), parts, true);
+    journal_used = true;
+    if (++journal_slot >= POWER_LOSS_JOURNAL_RECORDS) journal_slot = 0;
+    return ok;
+  }
+
+  /**
+   * Load the newest good record and continue the ring after it
+   */
+  void PrintJobRecovery::journal_read() {
+    journal_seq = journal_slot = 0;
+    if (journal_open()) {
+      uint8_t newest = 0xFF;
+      for (uint8_t s = 0; s < POWER_LOSS_JOURNAL_RECORDS; s++) {
+        uint32_t seq;
+        if (journal_read_slot(s, seq) && seq > journal_seq) { journal_seq = seq; newest = s; }
+      }
+      uint32_t seq;
+      if (newest != 0xFF && journal_read_slot(newest, seq)) {
+        journal_slot = (newest + 1) % (POWER_LOSS_JOURNAL_RECORDS);
+        return;
+      }
+      journal_used = false;
+    }
+    init();
+  }
+
+#endif // POWER_LOSS_JOURNAL
+
 /**
  * Resume the saved print job
  */
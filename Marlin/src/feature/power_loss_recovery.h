@@ -28,7 +28,11 @@
 #include "../sd/cardreader.h"
 #include "../inc/MarlinConfigPre.h"
 
-#define SAVE_INFO_INTERVAL_MS 0
+#if ENABLED(POWER_LOSS_EXACT_RESUME)
+  #define SAVE_INFO_INTERVAL_MS (POWER_LOSS_EXACT_INTERVAL * 1000UL)
+#else
+  #define SAVE_INFO_INTERVAL_MS 0
+#endif
 //#define SAVE_EACH_CMD_MODE
 //#define DEBUG_POWER_LOSS_RECOVERY
 
@@ -78,6 +82,21 @@ typedef struct {
 
 } job_recovery_info_t;
 
+#if ENABLED(POWER_LOSS_EXACT_RESUME)
+  #define SDPOS_NONE       0xFFFFFFFFUL   // Command didn't come from the SD file
+  #define SDPOS_NO_RESTART 0x80000000UL   // Flag: command can't be restarted part way through
+#endif
+
+#if ENABLED(POWER_LOSS_JOURNAL)
+  /**
+   * Each journal record is written as [seq][info][crc], padded out to whole blocks.
+   * The seq increases with every record (0 = empty slot) and the CRC16 covers seq and info.
+   */
+  #define JOURNAL_RECORD_SIZE   (sizeof(uint32_t) + sizeof(job_recovery_info_t) + sizeof(uint16_t))
+  #define JOURNAL_RECORD_BLOCKS ((JOURNAL_RECORD_SIZE + 511) / 512)
+  #define JOURNAL_FILE_SIZE     (uint32_t(POWER_LOSS_JOURNAL_RECORDS) * (JOURNAL_RECORD_BLOCKS) * 512)
+#endif
+
 class PrintJobRecovery {
   public:
     static SdFile file;
@@ -92,7 +111,13 @@ class PrintJobRecovery {
     static void check();
     static void resume();
 
-    static inline bool exists() { return card.jobRecoverFileExists(); }
+    static inline bool exists() {
+      #if ENABLED(POWER_LOSS_JOURNAL)
+        return journal_open() && journal_used;
+      #else
+        return card.jobRecoverFileExists();
+      #endif
+    }
     static inline void open(const bool read) { card.openJobRecoveryFile(read); }
     static inline void close() { file.close(); }
 
@@ -113,8 +138,27 @@ class PrintJobRecovery {
       static void debug(PGM_P const prefix);
     #endif
 
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      static uint32_t journal_block;  // First block of the journal file, 0 if not known yet
+      static void journal_clear();
+    #endif
+
   private:
     static void write();
+
+    #if ENABLED(POWER_LOSS_EXACT_RESUME)
+      static float planned_z;
+      static void save_executed_move();
+    #endif
+
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      static uint32_t journal_seq;
+      static uint8_t journal_slot;
+      static bool journal_used;       // Some slot may hold a record
+      static bool journal_open();
+      static bool journal_write();
+      static void journal_read();
+    #endif
 };
 
 extern PrintJobRecovery recovery;
@@ -46,6 +46,11 @@
  *   L[index]  Load UBL mesh from index (0 is default)
  *   T[map]    0:Human-readable 1:CSV 2:"LCD" 4:Compact
  *
+ * With MESH_STORAGE_SLOTS only:
+ *
+ *   W[index]  Save the current mesh to EEPROM slot index (0 is default)
+ *   L[index]  Load the mesh from EEPROM slot index (0 is default)
+ *
  * With mesh-based leveling only:
  *
  *   C         Center mesh on the mean of the lowest and highest
@@ -126,6 +131,27 @@ void GcodeSuite::M420() {
 
   #endif // AUTO_BED_LEVELING_UBL
 
+  #if ENABLED(MESH_STORAGE_SLOTS)
+
+    // W to save the current mesh to an EEPROM slot
+    if (parser.seen('W')) {
+      if (!leveling_is_valid()) {
+        SERIAL_ERROR_MSG("Invalid mesh.");
+        return;
+      }
+      settings.store_mesh(parser.has_value() ? parser.value_int() : 0);
+    }
+
+    // L to load a mesh from an EEPROM slot, leaving leveling off on failure
+    if (parser.seen('L')) {
+      set_bed_leveling_enabled(false);
+      if (!settings.load_mesh(parser.has_value() ? parser.value_int() : 0)) return;
+    }
+
+    if (parser.seen('V')) SERIAL_ECHOLNPAIR("Mesh storage slots: ", settings.calc_num_meshes());
+
+  #endif // MESH_STORAGE_SLOTS
+
   const bool seenV = parser.seen('V');
 
   #if HAS_MESH
@@ -200,6 +226,9 @@ void GcodeSuite::M420() {
           #if ENABLED(ABL_BILINEAR_SUBDIVISION)
             print_bilinear_leveling_grid_virt();
           #endif
+          #if ENABLED(ADAPTIVE_PROBING)
+            print_bilinear_sigma_grid();
+          #endif
         #elif ENABLED(MESH_BED_LEVELING)
           SERIAL_ECHOLNPGM("Mesh Bed Level data:");
           mbl.report_mesh();
@@ -48,6 +48,11 @@
   #include "../../../libs/least_squares_fit.h"
 #endif
 
+#if ENABLED(MESH_THERMAL_COMPENSATION)
+  #include "../../../feature/bedlevel/abl/mesh_thermal.h"
+  #include "../../../module/temperature.h"
+#endif
+
 #if ABL_PLANAR
   #include "../../../libs/vector_3.h"
 #endif
@@ -125,6 +130,12 @@
  *
  *  Z  Supply an additional Z probe offset
  *
+ * Parameters with G29_PROBE_PRINT_AREA only:
+ *
+ *  K  Keep the stored grid and only probe the grid points that enclose
+ *     the print area given by L, R, F, B (plus G29_PRINT_AREA_MARGIN).
+ *     The rest of the stored mesh is retained.
+ *
  * Extra parameters with PROBE_MANUALLY:
  *
  *  To do manual probing simply repeat G29 until the procedure is complete.
@@ -229,6 +240,11 @@ G29_TYPE GcodeSuite::G29() {
     ABL_VAR int left_probe_bed_position, right_probe_bed_position, front_probe_bed_position, back_probe_bed_position;
     ABL_VAR float xGridSpacing = 0, yGridSpacing = 0;
 
+    #if ENABLED(G29_PROBE_PRINT_AREA)
+      ABL_VAR bool area_only;
+      ABL_VAR uint8_t area_min[2], area_max[2]; // Grid indexes enclosing the print area
+    #endif
+
     #if ENABLED(AUTO_BED_LEVELING_LINEAR)
       ABL_VAR uint8_t abl_grid_points_x = GRID_MAX_POINTS_X,
                       abl_grid_points_y = GRID_MAX_POINTS_Y;
@@ -401,24 +417,64 @@ G29_TYPE GcodeSuite::G29() {
         back_probe_bed_position  = parser.seenval('B') ? (int)RAW_Y_POSITION(parser.value_linear_units()) : BACK_PROBE_BED_POSITION;
       }
 
-      if (
-        #if IS_SCARA || ENABLED(DELTA)
-             !position_is_reachable_by_probe(left_probe_bed_position, 0)
-          || !position_is_reachable_by_probe(right_probe_bed_position, 0)
-          || !position_is_reachable_by_probe(0, front_probe_bed_position)
-          || !position_is_reachable_by_probe(0, back_probe_bed_position)
-        #else
-             !position_is_reachable_by_probe(left_probe_bed_position, front_probe_bed_position)
-          || !position_is_reachable_by_probe(right_probe_bed_position, back_probe_bed_position)
-        #endif
-      ) {
-        SERIAL_ECHOLNPGM("? (L,R,F,B) out of bounds.");
-        G29_RETURN(false);
-      }
+      #if ENABLED(G29_PROBE_PRINT_AREA)
+        area_only = parser.seen('K');
+        if (area_only) {
+          if (!leveling_is_valid()) {
+            SERIAL_ERROR_MSG("No bilinear grid");
+            G29_RETURN(false);
+          }
+          if (left_probe_bed_position > right_probe_bed_position || front_probe_bed_position > back_probe_bed_position) {
+            SERIAL_ECHOLNPGM("? (L,R,F,B) print area is implausible.");
+            G29_RETURN(false);
+          }
 
-      // probe at the points of a lattice grid
-      xGridSpacing = (right_probe_bed_position - left_probe_bed_position) / (abl_grid_points_x - 1);
-      yGridSpacing = (back_probe_bed_position - front_probe_bed_position) / (abl_grid_points_y - 1);
+          // Find the stored grid cells touched by the print area plus margin
+          const float area_lo[2] = { left_probe_bed_position - (G29_PRINT_AREA_MARGIN), front_probe_bed_position - (G29_PRINT_AREA_MARGIN) },
+                      area_hi[2] = { right_probe_bed_position + (G29_PRINT_AREA_MARGIN), back_probe_bed_position + (G29_PRINT_AREA_MARGIN) };
+          for (uint8_t i = X_AXIS; i <= Y_AXIS; i++) {
+            const float lo = FLOOR((area_lo[i] - bilinear_start[i]) / bilinear_grid_spacing[i]),
+                        hi = CEIL((area_hi[i] - bilinear_start[i]) / bilinear_grid_spacing[i]);
+            const uint8_t last = (i == X_AXIS ? GRID_MAX_POINTS_X : GRID_MAX_POINTS_Y) - 1;
+            area_min[i] = constrain(lo, 0, last);
+            area_max[i] = constrain(hi, 0, last);
+          }
+
+          // Probe on the stored lattice so the grid is not reset
+          xGridSpacing = bilinear_grid_spacing[X_AXIS];
+          yGridSpacing = bilinear_grid_spacing[Y_AXIS];
+          left_probe_bed_position = bilinear_start[X_AXIS];
+          front_probe_bed_position = bilinear_start[Y_AXIS];
+
+          if (verbose_level > 0) {
+            SERIAL_ECHOPAIR("Print area grid X", int(area_min[X_AXIS]));
+            SERIAL_ECHOPAIR("-", int(area_max[X_AXIS]));
+            SERIAL_ECHOPAIR(" Y", int(area_min[Y_AXIS]));
+            SERIAL_ECHOLNPAIR("-", int(area_max[Y_AXIS]));
+          }
+        }
+        else
+      #endif
+      {
+        if (
+          #if IS_SCARA || ENABLED(DELTA)
+               !position_is_reachable_by_probe(left_probe_bed_position, 0)
+            || !position_is_reachable_by_probe(right_probe_bed_position, 0)
+            || !position_is_reachable_by_probe(0, front_probe_bed_position)
+            || !position_is_reachable_by_probe(0, back_probe_bed_position)
+          #else
+               !position_is_reachable_by_probe(left_probe_bed_position, front_probe_bed_position)
+            || !position_is_reachable_by_probe(right_probe_bed_position, back_probe_bed_position)
+          #endif
+        ) {
+          SERIAL_ECHOLNPGM("? (L,R,F,B) out of bounds.");
+          G29_RETURN(false);
+        }
+
+        // probe at the points of a lattice grid
+        xGridSpacing = (right_probe_bed_position - left_probe_bed_position) / (abl_grid_points_x - 1);
+        yGridSpacing = (back_probe_bed_position - front_probe_bed_position) / (abl_grid_points_y - 1);
+      }
 
     #endif // ABL_GRID
 
@@ -444,6 +500,11 @@ G29_TYPE GcodeSuite::G29() {
 
     if (!faux) setup_for_endstop_or_probe_move();
 
+    #if ENABLED(G29_PROBE_PRINT_AREA) && ENABLED(MESH_THERMAL_COMPENSATION)
+      // Points outside the area keep their old Z, so bring them to the current bed temperature
+      if (area_only && !dryrun) mesh_thermal.shift_to(thermalManager.degBed());
+    #endif
+
     #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
 
       #if ENABLED(PROBE_MANUALLY)
@@ -711,6 +772,12 @@ G29_TYPE GcodeSuite::G29() {
             if (!position_is_reachable_by_probe(xProbe, yProbe)) continue;
           #endif
 
+          #if ENABLED(G29_PROBE_PRINT_AREA)
+            // Keep the stored Z for points outside the print area
+            if (area_only && !(WITHIN(xCount, area_min[X_AXIS], area_max[X_AXIS]) && WITHIN(yCount, area_min[Y_AXIS], area_max[Y_AXIS])))
+              continue;
+          #endif
+
           measured_z = faux ? 0.001 * random(-100, 101) : probe_pt(xProbe, yProbe, raise_after, verbose_level);
 
           if (isnan(measured_z)) {
@@ -736,6 +803,11 @@ G29_TYPE GcodeSuite::G29() {
 
             z_values[xCount][yCount] = measured_z + zoffset;
 
+            #if ENABLED(ADAPTIVE_PROBING)
+              // Keep the spread of the samples as a per-point confidence
+              z_sigma[xCount][yCount] = faux ? 0 : MIN(probe_sigma * 1000 + 0.5f, 254);
+            #endif
+
           #endif
 
           abl_should_enable = false;
@@ -810,6 +882,9 @@ G29_TYPE GcodeSuite::G29() {
 
       if (!dryrun) extrapolate_unprobed_bed_level();
       print_bilinear_leveling_grid();
+      #if ENABLED(ADAPTIVE_PROBING)
+        if (verbose_level > 0) print_bilinear_sigma_grid();
+      #endif
 
       refresh_bed_level();
 
@@ -981,6 +1056,15 @@ G29_TYPE GcodeSuite::G29() {
         // and cause compensation movement in Z
         current_position[Z_AXIS] -= bilinear_z_offset(current_position);
 
+        #if ENABLED(MESH_THERMAL_COMPENSATION)
+          // A full mesh was probed at the current bed temperature.
+          // A print area re-probe was shifted to its reference before probing.
+          #if ENABLED(G29_PROBE_PRINT_AREA)
+            if (!area_only)
+          #endif
+              mesh_thermal.set_reference(thermalManager.degBed());
+        #endif
+
         #if ENABLED(DEBUG_LEVELING_FEATURE)
           if (DEBUGGING(LEVELING)) SERIAL_ECHOLNPAIR(" corrected Z:", current_position[Z_AXIS]);
         #endif
@@ -0,0 +1,103 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * G76.cpp - Mesh bed temperature compensation
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(MESH_THERMAL_COMPENSATION)
+
+#include "../../gcode.h"
+#include "../../../feature/bedlevel/bedlevel.h"
+#include "../../../feature/bedlevel/abl/mesh_thermal.h"
+#include "../../../module/temperature.h"
+#include "../../../lcd/ultralcd.h"
+
+/**
+ * G76: Calibrate mesh bed temperature compensation
+ *
+ * Compares the current mesh with a new mesh probed at another bed
+ * temperature and stores the change per degree for every grid point.
+ *
+ *  S<temp>  Bed temperature for the second mesh. Must differ from the
+ *           current bed temperature by at least 10°C.
+ *  R        Reset all coefficients to zero (no compensation)
+ *
+ * With no parameters, report the coefficients.
+ */
+void GcodeSuite::G76() {
+
+  if (parser.seen('R')) {
+    mesh_thermal.reset();
+    mesh_thermal.set_reference(thermalManager.degBed());
+    return;
+  }
+
+  if (!parser.seenval('S')) {
+    mesh_thermal.report();
+    return;
+  }
+
+  const int16_t target = parser.value_celsius();
+  if (!leveling_is_valid()) {
+    SERIAL_ERROR_MSG("Probe a mesh with G29 first.");
+    return;
+  }
+
+  // The baseline is the current mesh at the measured bed temperature
+  const float base_temp = thermalManager.degBed();
+  if (ABS(target - base_temp) < 10) {
+    SERIAL_ECHOLNPGM("?(S) must differ from the bed temperature by 10C or more.");
+    return;
+  }
+  mesh_thermal.shift_to(base_temp);
+
+  const int base_start[2] = { bilinear_start[X_AXIS], bilinear_start[Y_AXIS] },
+            base_spacing[2] = { bilinear_grid_spacing[X_AXIS], bilinear_grid_spacing[Y_AXIS] };
+
+  // Keep the current mesh raw while it is parked as the baseline
+  set_bed_leveling_enabled(false);
+  mesh_thermal.begin_calibration();
+
+  thermalManager.setTargetBed(target);
+  ui.set_status_P(thermalManager.isHeatingBed() ? PSTR(MSG_BED_HEATING) : PSTR(MSG_BED_COOLING));
+  thermalManager.wait_for_bed(false);
+
+  // Probe the second mesh. G29 sets the new mesh temperature.
+  process_subcommands_now_P(PSTR("G29"));
+
+  if (!leveling_is_valid()
+    || base_start[X_AXIS] != bilinear_start[X_AXIS] || base_start[Y_AXIS] != bilinear_start[Y_AXIS]
+    || base_spacing[X_AXIS] != bilinear_grid_spacing[X_AXIS] || base_spacing[Y_AXIS] != bilinear_grid_spacing[Y_AXIS]
+    || !mesh_thermal.finish_calibration(base_temp)
+  ) {
+    mesh_thermal.reset();
+    mesh_thermal.set_reference(thermalManager.degBed());
+    SERIAL_ERROR_MSG("Mesh temperature calibration failed.");
+  }
+  else
+    mesh_thermal.report();
+}
+
+#endif // MESH_THERMAL_COMPENSATION
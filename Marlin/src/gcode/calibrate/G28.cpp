@@ -45,7 +45,7 @@
 
 #include "../../lcd/ultralcd.h"
 
-#if ENABLED(QUICK_HOME)
+#if ENABLED(QUICK_HOME) && DISABLED(PARALLEL_HOMING)
 
   static void quick_home_xy() {
 
@@ -296,29 +296,41 @@ void GcodeSuite::G28(const bool always_home_all) {
       }
     }
 
-    #if ENABLED(QUICK_HOME)
+    #if ENABLED(QUICK_HOME) && DISABLED(PARALLEL_HOMING)
 
       if (home_all || (homeX && homeY)) quick_home_xy();
 
     #endif
 
+    // Home X and Y together. This replaces QUICK_HOME.
+    #if ENABLED(PARALLEL_HOMING)
+      const bool home_xy = home_all || (homeX && homeY)
+        #if ENABLED(CODEPENDENT_XY_HOMING)
+          || homeX || homeY
+        #endif
+      ;
+      if (home_xy) home_xy_parallel();
+    #else
+      constexpr bool home_xy = false;
+    #endif
+
     // Home Y (before X)
     #if ENABLED(HOME_Y_BEFORE_X)
 
-      if (home_all || homeY
+      if (!home_xy && (home_all || homeY
         #if ENABLED(CODEPENDENT_XY_HOMING)
           || homeX
         #endif
-      ) homeaxis(Y_AXIS);
+      )) homeaxis(Y_AXIS);
 
     #endif
 
     // Home X
-    if (home_all || homeX
+    if (!home_xy && (home_all || homeX
       #if ENABLED(CODEPENDENT_XY_HOMING) && DISABLED(HOME_Y_BEFORE_X)
         || homeY
       #endif
-    ) {
+    )) {
 
       #if ENABLED(DUAL_X_CARRIAGE)
 
@@ -347,7 +359,7 @@ void GcodeSuite::G28(const bool always_home_all) {
 
     // Home Y (after X)
     #if DISABLED(HOME_Y_BEFORE_X)
-      if (home_all || homeY) homeaxis(Y_AXIS);
+      if (!home_xy && (home_all || homeY)) homeaxis(Y_AXIS);
     #endif
 
     // Home Z last if homing towards the bed
@@ -161,6 +161,9 @@ void GcodeSuite::G34() {
 
       if (err_break) break;
 
+      // Let the last probe raise finish before the Z steppers are split up
+      planner.synchronize();
+
       // Remember the current z position to return to
       float z_original_position = current_position[Z_AXIS];
 
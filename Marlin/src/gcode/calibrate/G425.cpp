@@ -598,7 +598,7 @@ float measuring_movement(const AxisEnum axis, const int dir, const bool stopping
   while (travel < limit) {
     set_destination_from_current();
     destination[axis] += float(dir) * resolution;
-    do_blocking_move_to(destination[X_AXIS], destination[Y_AXIS], destination[Z_AXIS], MMM_TO_MMS(feedrate));
+    plan_move_to(destination[X_AXIS], destination[Y_AXIS], destination[Z_AXIS], MMM_TO_MMS(feedrate));
     planner.synchronize();
 
     if(read_probe_value() != stopping_state)
@@ -634,9 +634,10 @@ float measure(const AxisEnum axis, const int dir, const bool stopping_state, flo
     const float release_pos = measuring_movement(axis, -1 * dir, !stopping_state, resolution, feedrate, limit);
     *backlash_ptr = ABS(release_pos - measured_position);
   }
-  // Return to starting position
+  // Return to starting position. Only queued, as the next
+  // measuring_movement waits before it reads the probe.
   destination[axis] = start_pos;
-  do_blocking_move_to(destination[X_AXIS], destination[Y_AXIS], destination[Z_AXIS], MMM_TO_MMS(CALIBRATION_TRAVEL_FEEDRATE));
+  plan_move_to(destination[X_AXIS], destination[Y_AXIS], destination[Z_AXIS], MMM_TO_MMS(CALIBRATION_TRAVEL_FEEDRATE));
   return measured_position;
 }
 
@@ -659,8 +660,9 @@ void move_to(
   destination[Y_AXIS] = MAX(MIN(destination[Y_AXIS],Y_MAX_POS),Y_MIN_POS);
   destination[Z_AXIS] = MAX(MIN(destination[Z_AXIS],Z_MAX_POS),Z_MIN_POS);
 
-  // Move to commanded destination
-  do_blocking_move_to(destination[X_AXIS], destination[Y_AXIS], destination[Z_AXIS], MMM_TO_MMS(CALIBRATION_TRAVEL_FEEDRATE));
+  // Queue the move to the commanded destination. The next measurement
+  // waits for it, so consecutive travel moves are planned together.
+  plan_move_to(destination[X_AXIS], destination[Y_AXIS], destination[Z_AXIS], MMM_TO_MMS(CALIBRATION_TRAVEL_FEEDRATE));
 }
 
 #endif // CALIBRATION_GCODE
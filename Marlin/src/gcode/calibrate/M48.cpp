@@ -27,6 +27,7 @@
 #include "../gcode.h"
 #include "../../module/motion.h"
 #include "../../module/probe.h"
+#include "../../libs/sample_stats.h"
 
 #include "../../feature/bedlevel/bedlevel.h"
 
@@ -109,7 +110,8 @@ void GcodeSuite::M48() {
 
   setup_for_endstop_or_probe_move();
 
-  float mean = 0.0, sigma = 0.0, min = 99999.9, max = -99999.9, sample_set[n_samples];
+  float sample_set[n_samples];
+  sample_stats stats;
 
   // Move to the first point, deploy, and probe
   const float t = probe_pt(X_probe_location, Y_probe_location, raise_after, verbose_level);
@@ -195,35 +197,22 @@ void GcodeSuite::M48() {
       if (!probing_good) break;
 
       /**
-       * Get the current mean for the data points we have so far
-       */
-      float sum = 0.0;
-      for (uint8_t j = 0; j <= n; j++) sum += sample_set[j];
-      mean = sum / (n + 1);
-
-      NOMORE(min, sample_set[n]);
-      NOLESS(max, sample_set[n]);
-
-      /**
-       * Now, use that mean to calculate the standard deviation for the
+       * Update the mean and standard deviation of the
        * data points we have so far
        */
-      sum = 0.0;
-      for (uint8_t j = 0; j <= n; j++)
-        sum += sq(sample_set[j] - mean);
+      stats.add(sample_set[n]);
 
-      sigma = SQRT(sum / (n + 1));
       if (verbose_level > 0) {
         if (verbose_level > 1) {
           SERIAL_ECHO(n + 1);
           SERIAL_ECHOPAIR(" of ", (int)n_samples);
           SERIAL_ECHOPAIR_F(": z: ", sample_set[n], 3);
           if (verbose_level > 2) {
-            SERIAL_ECHOPAIR_F(" mean: ", mean, 4);
-            SERIAL_ECHOPAIR_F(" sigma: ", sigma, 6);
-            SERIAL_ECHOPAIR_F(" min: ", min, 3);
-            SERIAL_ECHOPAIR_F(" max: ", max, 3);
-            SERIAL_ECHOPAIR_F(" range: ", max-min, 3);
+            SERIAL_ECHOPAIR_F(" mean: ", stats.mean, 4);
+            SERIAL_ECHOPAIR_F(" sigma: ", stats.sigma(), 6);
+            SERIAL_ECHOPAIR_F(" min: ", stats.min, 3);
+            SERIAL_ECHOPAIR_F(" max: ", stats.max, 3);
+            SERIAL_ECHOPAIR_F(" range: ", stats.range(), 3);
           }
           SERIAL_EOL();
         }
@@ -238,13 +227,18 @@ void GcodeSuite::M48() {
     SERIAL_ECHOLNPGM("Finished!");
 
     if (verbose_level > 0) {
-      SERIAL_ECHOPAIR_F("Mean: ", mean, 6);
-      SERIAL_ECHOPAIR_F(" Min: ", min, 3);
-      SERIAL_ECHOPAIR_F(" Max: ", max, 3);
-      SERIAL_ECHOLNPAIR_F(" Range: ", max-min, 3);
+      SERIAL_ECHOPAIR_F("Mean: ", stats.mean, 6);
+      SERIAL_ECHOPAIR_F(" Min: ", stats.min, 3);
+      SERIAL_ECHOPAIR_F(" Max: ", stats.max, 3);
+      SERIAL_ECHOLNPAIR_F(" Range: ", stats.range(), 3);
+      if (verbose_level > 1) {
+        const float median = samples_median(sample_set, n_samples);
+        SERIAL_ECHOPAIR_F("Median: ", median, 6);
+        SERIAL_ECHOLNPAIR_F(" MAD: ", samples_mad(sample_set, n_samples, median), 6);
+      }
     }
 
-    SERIAL_ECHOLNPAIR_F("Standard Deviation: ", sigma, 6);
+    SERIAL_ECHOLNPAIR_F("Standard Deviation: ", stats.sigma(), 6);
     SERIAL_EOL();
   }
 
@@ -0,0 +1,86 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(INPUT_SHAPING)
+
+#include "../../gcode.h"
+#include "../../../module/planner.h"
+#include "../../../module/stepper.h"
+
+/**
+ * M593: Get or Set Input Shaping for X and Y
+ *
+ *  X           Set the X axis only
+ *  Y           Set the Y axis only
+ *  F<hz>       Resonant frequency. 0 turns shaping off.
+ *  D<damping>  Damping ratio (0-<1)
+ *  T<type>     Shaper type: 0=ZV 1=ZVD 2=MZV
+ *
+ * With no X or Y both axes are set.
+ */
+void GcodeSuite::M593() {
+  const bool seen_x = parser.seen('X'), seen_y = parser.seen('Y'),
+             set_x = seen_x || !seen_y, set_y = seen_y || !seen_x;
+
+  if (parser.seen('F') || parser.seen('D') || parser.seen('T')) {
+    const float freq = parser.floatval('F', -1), damping = parser.floatval('D', -1);
+    const int type = parser.intval('T', -1);
+    if (parser.seen('F') && freq < 0) {
+      SERIAL_ECHOLNPGM("?F value out of range (0+).");
+      return;
+    }
+    if (parser.seen('D') && !WITHIN(damping, 0, 0.99f)) {
+      SERIAL_ECHOLNPGM("?D value out of range (0-0.99).");
+      return;
+    }
+    if (parser.seen('T') && !WITHIN(type, SHAPER_ZV, SHAPER_MZV)) {
+      SERIAL_ECHOLNPGM("?T value out of range (0-2).");
+      return;
+    }
+
+    // Let the moves in the queue finish with the old shapers
+    planner.synchronize();
+
+    LOOP_L_N(i, 2) if (i == X_AXIS ? set_x : set_y) {
+      stepper.set_shaper((AxisEnum)i,
+        type < 0 ? stepper.shaper_type[i] : (ShaperType)type,
+        freq < 0 ? stepper.shaper_frequency[i] : freq,
+        damping < 0 ? stepper.shaper_damping[i] : damping
+      );
+    }
+  }
+  else {
+    static const char shaper_name[][4] PROGMEM = { "ZV", "ZVD", "MZV" };
+    LOOP_L_N(i, 2) if (i == X_AXIS ? set_x : set_y) {
+      SERIAL_ECHO_START();
+      SERIAL_CHAR(axis_codes[i]);
+      SERIAL_ECHOPGM(" Shaper ");
+      serialprintPGM(shaper_name[stepper.shaper_type[i]]);
+      SERIAL_ECHOPAIR(" F", stepper.shaper_frequency[i]);
+      SERIAL_ECHOLNPAIR(" D", stepper.shaper_damping[i]);
+    }
+  }
+}
+
+#endif // INPUT_SHAPING
@@ -36,6 +36,10 @@ GcodeSuite gcode;
   #include "../module/printcounter.h"
 #endif
 
+#if ENABLED(PATH_BLENDING)
+  #include "../feature/path_blending.h"
+#endif
+
 #include "../Marlin.h" // for idle() and suspend_auto_report
 
 millis_t GcodeSuite::previous_move_ms;
@@ -97,8 +101,12 @@ void GcodeSuite::get_destination_from_command() {
     feedrate_mm_s = MMM_TO_MMS(parser.value_feedrate());
 
   #if ENABLED(PRINTCOUNTER)
-    if (!DEBUGGING(DRYRUN))
+    if (!DEBUGGING(DRYRUN)) {
       print_job_timer.incFilamentUsed(destination[E_AXIS] - current_position[E_AXIS]);
+      #if ENABLED(PRINTCOUNTER_MAINTENANCE)
+        LOOP_XYZ(i) print_job_timer.incAxisTravel((AxisEnum)i, destination[i] - current_position[i]);
+      #endif
+    }
   #endif
 
   // Get ABCDHI mixing factors
@@ -182,6 +190,11 @@ void GcodeSuite::process_parsed_command(
 ) {
   KEEPALIVE_STATE(IN_HANDLER);
 
+  #if ENABLED(PATH_BLENDING)
+    // Queue a held move before anything but another G0/G1
+    if (parser.command_letter != 'G' || parser.codenum > 1) path_blending.flush();
+  #endif
+
   // Handle a known G, M, or T
   switch (parser.command_letter) {
     case 'G': switch (parser.codenum) {
@@ -270,6 +283,11 @@ void GcodeSuite::process_parsed_command(
         case 80: G80(); break;                                    // G80: Reset the current motion mode
       #endif
 
+      #if ENABLED(PATH_BLENDING)
+        case 61: G61(); break;                                    // G61: Exact path mode
+        case 64: G64(); break;                                    // G64: Continuous path mode
+      #endif
+
       case 90: relative_mode = false; break;                      // G90: Relative Mode
       case 91: relative_mode = true; break;                       // G91: Absolute Mode
 
@@ -279,6 +297,10 @@ void GcodeSuite::process_parsed_command(
         case 42: G42(); break;                                    // G42: Coordinated move to a mesh point
       #endif
 
+      #if ENABLED(MESH_THERMAL_COMPENSATION)
+        case 76: G76(); break;                                    // G76: Calibrate mesh bed temperature compensation
+      #endif
+
       #if ENABLED(LULZBOT_CALIBRATION_GCODE)
         case 425:
           LULZBOT_ENABLE_PROBE_PINS(true);
@@ -627,6 +649,10 @@ void GcodeSuite::process_parsed_command(
         case 540: M540(); break;                                  // M540: Set abort on endstop hit for SD printing
       #endif
 
+      #if ENABLED(INPUT_SHAPING)
+        case 593: M593(); break;                                  // M593: Set input shaping
+      #endif
+
       #if HAS_BED_PROBE
         case 851: M851(); break;                                  // M851: Set Z Probe Z Offset
       #endif
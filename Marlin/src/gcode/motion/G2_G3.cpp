@@ -48,6 +48,10 @@
  * Arcs should only be made relatively large (over 5mm), as larger arcs with
  * larger segments will tend to be more efficient. Your slicer should have
  * options for G2/G3 arc generation. In future these options may be GCode tunable.
+ *
+ * With ARC_CHORD_SEGMENTS the segments are instead as long as ARC_CHORD_TOLERANCE
+ * allows, but no shorter than the feedrate covers in MIN_ARC_SEGMENT_TIME. The
+ * junctions between segments are then planned with the arc's own radius.
  */
 void plan_arc(
   const float (&cart)[XYZE],  // Destination position
@@ -93,7 +97,36 @@ void plan_arc(
               mm_of_travel = linear_travel ? HYPOT(flat_mm, linear_travel) : ABS(flat_mm);
   if (mm_of_travel < 0.001f) return;
 
-  uint16_t segments = FLOOR(mm_of_travel / (MM_PER_ARC_SEGMENT));
+  const float fr_mm_s = MMS_SCALED(feedrate_mm_s);
+
+  #if ENABLED(NATIVE_ARC_BLOCKS)
+    // Queue an XY arc as a single block when nothing has to bend its path
+    if (p_axis == X_AXIS
+      #if HAS_LEVELING
+        && !planner.leveling_active
+      #endif
+      #if HAS_SOFTWARE_ENDSTOPS
+        && !(soft_endstops_enabled && (
+             center_P - radius < soft_endstop_min[X_AXIS] || center_P + radius > soft_endstop_max[X_AXIS]
+          || center_Q - radius < soft_endstop_min[Y_AXIS] || center_Q + radius > soft_endstop_max[Y_AXIS]
+        ))
+      #endif
+    ) {
+      const float center[2] = { center_P, center_Q };
+      if (planner.buffer_arc(cart, center, angular_travel, fr_mm_s, active_extruder, mm_of_travel)) {
+        COPY(current_position, cart);
+        return;
+      }
+    }
+  #endif
+
+  #if ENABLED(ARC_CHORD_SEGMENTS)
+    // A chord of length L deviates from the arc by r * (1 - cos(L / 2r)) ~= L^2 / 8r
+    const float seg_mm = MAX(SQRT(8.0f * (ARC_CHORD_TOLERANCE) * radius), fr_mm_s * (MIN_ARC_SEGMENT_TIME), 0.001f);
+    uint16_t segments = CEIL(MIN(mm_of_travel / seg_mm, 65535.0f));
+  #else
+    uint16_t segments = FLOOR(mm_of_travel / (MM_PER_ARC_SEGMENT));
+  #endif
   if (segments == 0) segments = 1;
 
   /**
@@ -127,8 +160,18 @@ void plan_arc(
   const float theta_per_segment = angular_travel / segments,
               linear_per_segment = linear_travel / segments,
               extruder_per_segment = extruder_travel / segments,
-              sin_T = theta_per_segment,
-              cos_T = 1 - 0.5f * sq(theta_per_segment); // Small angle approximation
+              #if ENABLED(ARC_CHORD_SEGMENTS)
+                segment_mm = mm_of_travel / segments,   // Real length of each segment
+                sin_T = sin(theta_per_segment),         // Segments may be too long for the
+                cos_T = cos(theta_per_segment);         //  small angle approximation
+              #else
+                sin_T = theta_per_segment,
+                cos_T = 1 - 0.5f * sq(theta_per_segment); // Small angle approximation
+              #endif
+
+  #if DISABLED(ARC_CHORD_SEGMENTS)
+    constexpr float segment_mm = MM_PER_ARC_SEGMENT;
+  #endif
 
   // Initialize the linear axis
   raw[l_axis] = current_position[l_axis];
@@ -136,10 +179,8 @@ void plan_arc(
   // Initialize the extruder axis
   raw[E_AXIS] = current_position[E_AXIS];
 
-  const float fr_mm_s = MMS_SCALED(feedrate_mm_s);
-
   #if ENABLED(SCARA_FEEDRATE_SCALING)
-    const float inv_duration = fr_mm_s / MM_PER_ARC_SEGMENT;
+    const float inv_duration = fr_mm_s / segment_mm;
   #endif
 
   millis_t next_idle_ms = millis() + 200UL;
@@ -148,6 +189,11 @@ void plan_arc(
     int8_t arc_recalc_count = N_ARC_CORRECTION;
   #endif
 
+  #if ENABLED(ARC_CHORD_SEGMENTS)
+    // Queue the segments as one planner batch
+    planner.begin_batch();
+  #endif
+
   for (uint16_t i = 1; i < segments; i++) { // Iterate (segments-1) times
 
     thermalManager.manage_heater();
@@ -195,12 +241,16 @@ void plan_arc(
       planner.apply_leveling(raw);
     #endif
 
-    if (!planner.buffer_line(raw, fr_mm_s, active_extruder, MM_PER_ARC_SEGMENT
+    if (!planner.buffer_line(raw, fr_mm_s, active_extruder, segment_mm
       #if ENABLED(SCARA_FEEDRATE_SCALING)
         , inv_duration
       #endif
     ))
       break;
+
+    #if ENABLED(ARC_CHORD_SEGMENTS)
+      planner.arc_radius = radius; // Junctions after the first segment are inside the arc
+    #endif
   }
 
   // Ensure last segment arrives at target location.
@@ -213,12 +263,17 @@ void plan_arc(
     planner.apply_leveling(raw);
   #endif
 
-  planner.buffer_line(raw, fr_mm_s, active_extruder, MM_PER_ARC_SEGMENT
+  planner.buffer_line(raw, fr_mm_s, active_extruder, segment_mm
     #if ENABLED(SCARA_FEEDRATE_SCALING)
       , inv_duration
     #endif
   );
 
+  #if ENABLED(ARC_CHORD_SEGMENTS)
+    planner.arc_radius = 0;
+    planner.end_batch();
+  #endif
+
   #if ENABLED(AUTO_BED_LEVELING_UBL)
     raw[l_axis] = start_L;
   #endif
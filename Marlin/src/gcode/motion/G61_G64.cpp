@@ -0,0 +1,48 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(PATH_BLENDING)
+
+#include "../gcode.h"
+#include "../../feature/path_blending.h"
+
+/**
+ * G61: Exact path mode. Queue G0/G1 moves as given.
+ */
+void GcodeSuite::G61() { path_blending.enabled = false; }
+
+/**
+ * G64: Continuous path mode. Merge runs of short G0/G1 moves and
+ *      blend the corners between them.
+ *
+ *   P<linear> - Largest distance from a corner to its blend. 0 for no blending.
+ *   Q<linear> - Largest distance from a merged point to the merged move.
+ */
+void GcodeSuite::G64() {
+  if (parser.seenval('P')) path_blending.blend_tolerance = MAX(parser.value_linear_units(), 0);
+  if (parser.seenval('Q')) path_blending.merge_tolerance = MAX(parser.value_linear_units(), 0);
+  path_blending.enabled = true;
+}
+
+#endif // PATH_BLENDING
@@ -70,6 +70,13 @@ char command_queue[BUFSIZE][MAX_CMD_SIZE];
   int16_t command_queue_port[BUFSIZE];
 #endif
 
+/*
+ * The SD file offset of each command (See SDPOS_NONE / SDPOS_NO_RESTART)
+ */
+#if ENABLED(POWER_LOSS_EXACT_RESUME)
+  uint32_t command_sdpos[BUFSIZE];
+#endif
+
 /**
  * Serial command injection
  */
@@ -126,6 +133,9 @@ inline bool _enqueuecommand(const char* cmd, bool say_ok=false
 ) {
   if (*cmd == ';' || commands_in_queue >= BUFSIZE) return false;
   strcpy(command_queue[cmd_queue_index_w], cmd);
+  #if ENABLED(POWER_LOSS_EXACT_RESUME)
+    command_sdpos[cmd_queue_index_w] = SDPOS_NONE;
+  #endif
   _commit_command(say_ok
     #if NUM_SERIAL > 1
       , port
@@ -361,6 +371,60 @@ static int read_serial(const uint8_t index) {
       return ((seed ^ value) ^ (seed << 8)) & 0xFFFF;
     }
 
+    #ifdef FAST_FILE_TRANSFER_PACKET_SIZE
+
+      // Send the assembled block, starting a multi-block write if needed
+      bool write_block() {
+        Sd2Card &sd2card = card.getSd2Card();
+        if (!blocks_left) return false;
+        if (!writing_blocks && !(writing_blocks = sd2card.writeStart(raw_block, blocks_left))) return false;
+        if (!sd2card.writeData((uint8_t*)block_buffer)) return false;
+        raw_block++;
+        blocks_left--;
+        block_fill = 0;
+        return true;
+      }
+
+      // End the multi-block write so the card can be used by others
+      bool write_stop() {
+        if (!writing_blocks) return true;
+        writing_blocks = false;
+        return card.getSd2Card().writeStop();
+      }
+
+    #endif
+
+    // Append packet data to the file
+    bool write_data(const char *data, uint16_t len) {
+      #ifdef FAST_FILE_TRANSFER_PACKET_SIZE
+        if (raw_block) {
+          while (len) {
+            const uint16_t n = MIN(len, uint16_t(sizeof(block_buffer) - block_fill));
+            memcpy(&block_buffer[block_fill], data, n);
+            block_fill += n;
+            data += n;
+            len -= n;
+            if (block_fill == sizeof(block_buffer) && !write_block()) return false;
+          }
+          return true;
+        }
+      #endif
+      return card.write((void*)data, len) >= 0;
+    }
+
+    // Write out the final partial block
+    bool write_finish() {
+      #ifdef FAST_FILE_TRANSFER_PACKET_SIZE
+        if (raw_block && block_fill) {
+          memset(&block_buffer[block_fill], 0, sizeof(block_buffer) - block_fill);
+          if (!write_block()) return false;
+        }
+        return write_stop();
+      #else
+        return true;
+      #endif
+    }
+
     // read the next byte from the data stream keeping track of
     // whether the stream times out from data starvation
     // takes the data variable by reference in order to return status
@@ -395,6 +459,13 @@ static int read_serial(const uint8_t index) {
               stream_state = StreamState::PACKET_RESET;
               bytes_received = 0;
               time_stream_start = millis();
+              #ifdef FAST_FILE_TRANSFER_PACKET_SIZE
+                // Preallocate so whole blocks go straight to the card.
+                // If that fails, write through the file system instead.
+                block_fill = 0;
+                blocks_left = (stream_header.filesize + 511) >> 9;
+                raw_block = stream_header.filesize ? card.preallocateFile(stream_header.filesize) : 0;
+              #endif
               CARD_ECHO_P("echo: Datastream initialized (");
               CARD_ECHO_P(stream_header.filesize);
               CARD_ECHOLN_P("Bytes expected)");
@@ -462,7 +533,7 @@ static int read_serial(const uint8_t index) {
                 else  {
                   stream_state = StreamState::STREAM_COMPLETE; // no more data required
                 }
-                if (card.write(buffer, buffer_next_index) < 0) {
+                if (!write_data(buffer, buffer_next_index)) {
                   stream_state = StreamState::STREAM_FAILED;
                   CARD_ECHO_P("echo: IO ERROR");
                   break;
@@ -502,6 +573,11 @@ static int read_serial(const uint8_t index) {
             stream_state = StreamState::PACKET_RESEND;
             break;
           case StreamState::STREAM_COMPLETE:
+            if (!write_finish()) {
+              stream_state = StreamState::STREAM_FAILED;
+              CARD_ECHO_P("echo: IO ERROR");
+              break;
+            }
             stream_state = StreamState::STREAM_RESET;
             card.flag.binary_mode = false;
             card.closefile();
@@ -513,6 +589,9 @@ static int read_serial(const uint8_t index) {
             CARD_ECHOLN_P("sc"); // transmit stream complete token
             return;
           case StreamState::STREAM_FAILED:
+            #ifdef FAST_FILE_TRANSFER_PACKET_SIZE
+              write_stop();
+            #endif
             stream_state = StreamState::STREAM_RESET;
             card.flag.binary_mode = false;
             card.closefile();
@@ -522,6 +601,9 @@ static int read_serial(const uint8_t index) {
             return;
         }
       }
+      #ifdef FAST_FILE_TRANSFER_PACKET_SIZE
+        if (!write_stop()) stream_state = StreamState::STREAM_FAILED;
+      #endif
     }
 
     static const uint16_t STREAM_MAX_WAIT = 500, RX_TIMESLICE = 20, MAX_RETRIES = 3;
@@ -531,6 +613,14 @@ static int read_serial(const uint8_t index) {
     millis_t time_stream_start;
     StreamState stream_state = StreamState::STREAM_RESET;
 
+    #ifdef FAST_FILE_TRANSFER_PACKET_SIZE
+      char packet_buffer[FAST_FILE_TRANSFER_PACKET_SIZE], // Larger packets than the command line allows
+           block_buffer[512];                            // One SD block, assembled from packets
+      uint16_t block_fill;                               // Bytes in block_buffer
+      uint32_t raw_block, blocks_left;                   // Next block to write, 0 without preallocation
+      bool writing_blocks;                               // A multi-block write is open
+    #endif
+
   } binaryStream{};
 
 #endif // FAST_FILE_TRANSFER
@@ -555,7 +645,13 @@ inline void get_serial_commands() {
        * receive buffer (which limits the packet size to MAX_CMD_SIZE).
        * The receive buffer also limits the packet size for reliable transmission.
        */
-      binaryStream.receive(serial_line_buffer[card.transfer_port]);
+      binaryStream.receive(
+        #ifdef FAST_FILE_TRANSFER_PACKET_SIZE
+          binaryStream.packet_buffer
+        #else
+          serial_line_buffer[card.transfer_port]
+        #endif
+      );
       return;
     }
   #endif
@@ -709,6 +805,14 @@ inline void get_serial_commands() {
 
 #if ENABLED(SDSUPPORT)
 
+  #if ENABLED(POWER_LOSS_EXACT_RESUME)
+    // A G0/G1 can be restarted from any point along its move
+    inline bool restartable_command(const char *cmd) {
+      while (*cmd == ' ') cmd++;
+      return (cmd[0] == 'G' || cmd[0] == 'g') && (cmd[1] == '0' || cmd[1] == '1') && !NUMERIC(cmd[2]);
+    }
+  #endif
+
   /**
    * Get commands from the SD Card until the command buffer is full
    * or until the end of the file is reached. The special character '#'
@@ -734,6 +838,9 @@ inline void get_serial_commands() {
     if (commands_in_queue == 0) stop_buffering = false;
 
     uint16_t sd_count = 0;
+    #if ENABLED(POWER_LOSS_EXACT_RESUME)
+      uint32_t sd_line_pos = 0;
+    #endif
     bool card_eof = card.eof();
     while (commands_in_queue < BUFSIZE && !card_eof && !stop_buffering) {
       const int16_t n = card.get();
@@ -788,6 +895,10 @@ inline void get_serial_commands() {
 
         LULZBOT_SDCARD_COMMAND_DONE(command_queue[cmd_queue_index_w])
 
+        #if ENABLED(POWER_LOSS_EXACT_RESUME)
+          command_sdpos[cmd_queue_index_w] = sd_line_pos | (restartable_command(command_queue[cmd_queue_index_w]) ? 0 : SDPOS_NO_RESTART);
+        #endif
+
         _commit_command(false);
       }
       else if (sd_count >= MAX_CMD_SIZE - 1) {
@@ -806,7 +917,12 @@ inline void get_serial_commands() {
           #if ENABLED(PAREN_COMMENTS)
             && ! sd_comment_paren_mode
           #endif
-        ) command_queue[cmd_queue_index_w][sd_count++] = sd_char;
+        ) {
+          #if ENABLED(POWER_LOSS_EXACT_RESUME)
+            if (!sd_count) sd_line_pos = card.getIndex(); // Where this command starts in the file
+          #endif
+          command_queue[cmd_queue_index_w][sd_count++] = sd_char;
+        }
       }
     }
   }
@@ -869,6 +985,14 @@ void advance_command_queue() {
       }
     }
     else {
+      #if ENABLED(POWER_LOSS_EXACT_RESUME)
+        // Blocks made by this command point back to its line. A move made in
+        // relative mode can't be restarted from a saved absolute position.
+        uint32_t line = command_sdpos[cmd_queue_index_r];
+        if (relative_mode) line |= SDPOS_NO_RESTART;
+        LOOP_XYZE(i) if (gcode.axis_relative_modes[i]) line |= SDPOS_NO_RESTART;
+        planner.sdpos = line;
+      #endif
       gcode.process_next_command();
       #if ENABLED(POWER_LOSS_RECOVERY)
         if (IS_SD_PRINTING()) recovery.save();
@@ -56,6 +56,13 @@ extern char command_queue[BUFSIZE][MAX_CMD_SIZE];
   extern int16_t command_queue_port[BUFSIZE];
 #endif
 
+/*
+ * The SD file offset of each command (See SDPOS_NONE / SDPOS_NO_RESTART)
+ */
+#if ENABLED(POWER_LOSS_EXACT_RESUME)
+  extern uint32_t command_sdpos[BUFSIZE];
+#endif
+
 /**
  * Initialization of queue for setup()
  */
@@ -30,6 +30,10 @@
 #include "../../module/stepper.h"
 #include "../../lcd/ultralcd.h"
 
+#if ENABLED(SDCARD_FILE_INDEX)
+  #include "../../module/motion.h"
+#endif
+
 #if ENABLED(POWER_LOSS_RECOVERY)
   #include "../../feature/power_loss_recovery.h"
 #endif
@@ -134,9 +138,36 @@ void GcodeSuite::M25() {
 
 /**
  * M26: Set SD Card file index
+ *
+ *  S<pos>   - File position in bytes
+ *  L<layer> - Start of an indexed layer, counting from 1. Also sets
+ *             the E position the file had there. (Requires SDCARD_FILE_INDEX)
  */
 void GcodeSuite::M26() {
-  if (card.isDetected() && parser.seenval('S'))
+  if (!card.isDetected()) return;
+
+  #if ENABLED(SDCARD_FILE_INDEX)
+    if (parser.seenval('L')) {
+      if (!card.isFileOpen()) return;         // Only for the selected file
+      const uint16_t l = parser.value_ushort();
+      file_index_layer_t rec;
+      if (!l || !file_index.layer(l - 1, rec)) {
+        SERIAL_ERROR_MSG("Layer not indexed");
+        return;
+      }
+      card.setIndex(rec.offset);
+      current_position[E_AXIS] = rec.e;
+      sync_plan_position_e();
+      SERIAL_ECHO_START();
+      SERIAL_ECHOPAIR("Layer ", l);
+      SERIAL_ECHOPAIR(" Z", rec.z);
+      SERIAL_ECHOPAIR(" E", rec.e);
+      SERIAL_ECHOLNPAIR(" pos ", rec.offset);
+      return;
+    }
+  #endif
+
+  if (parser.seenval('S'))
     card.setIndex(parser.value_long());
 }
 
@@ -61,10 +61,17 @@ void GcodeSuite::M77() {
 
 /**
  * M78: Show print statistics
+ *
+ *  S78 - Reset the statistics
+ *  J   - Report all counters as one line of JSON (Requires PRINTCOUNTER_MAINTENANCE)
  */
 void GcodeSuite::M78() {
   if (parser.intval('S') == 78)   // "M78 S78" will reset the statistics
     print_job_timer.initStats();
+  #if ENABLED(PRINTCOUNTER_MAINTENANCE)
+    else if (parser.seen('J'))
+      print_job_timer.reportMaintenance();
+  #endif
   else
     print_job_timer.showStats();
 }
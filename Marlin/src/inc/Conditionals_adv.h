@@ -42,3 +42,8 @@
   // SERIAL_XON_XOFF not supported on USB-native devices
   #undef SERIAL_XON_XOFF
 #endif
+
+// Character LCD boot screens are animated with delays, so skip them
+#if ENABLED(FAST_BOOT) && !HAS_GRAPHICAL_LCD
+  #undef SHOW_BOOTSCREEN
+#endif
@@ -547,6 +547,34 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #endif
 #endif
 
+/**
+ * Binary file transfer
+ */
+#ifdef FAST_FILE_TRANSFER_PACKET_SIZE
+  #if DISABLED(FAST_FILE_TRANSFER)
+    #error "FAST_FILE_TRANSFER_PACKET_SIZE requires FAST_FILE_TRANSFER."
+  #elif !WITHIN(FAST_FILE_TRANSFER_PACKET_SIZE, 64, 4096)
+    #error "FAST_FILE_TRANSFER_PACKET_SIZE must be from 64 to 4096."
+  #elif !(defined(__AVR__) && defined(USBCON)) && FAST_FILE_TRANSFER_PACKET_SIZE > RX_BUFFER_SIZE \
+    && (SERIAL_PORT >= 0 || (defined(SERIAL_PORT_2) && SERIAL_PORT_2 >= 0))
+    #error "FAST_FILE_TRANSFER_PACKET_SIZE must not exceed RX_BUFFER_SIZE on a UART serial port."
+  #endif
+#endif
+
+/**
+ * SD log write-behind
+ */
+#if ENABLED(SDCARD_LOG_WRITE_BEHIND) && !WITHIN(SDCARD_LOG_PREALLOCATE_KB, 1, 65535)
+  #error "SDCARD_LOG_PREALLOCATE_KB must be from 1 to 65535."
+#endif
+
+/**
+ * SD Directory Index
+ */
+#if ENABLED(SDCARD_DIR_INDEX) && !WITHIN(SDCARD_DIR_INDEX_LIMIT, 1, 1024)
+  #error "SDCARD_DIR_INDEX_LIMIT must be from 1 to 1024."
+#endif
+
 /**
  * I2C Position Encoders
  */
@@ -772,6 +800,108 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   );
 #endif
 
+/**
+ * Arc segmentation by chord tolerance
+ */
+#if ENABLED(ARC_CHORD_SEGMENTS)
+  #if DISABLED(ARC_SUPPORT)
+    #error "ARC_CHORD_SEGMENTS requires ARC_SUPPORT."
+  #endif
+  static_assert(ARC_CHORD_TOLERANCE > 0, "ARC_CHORD_TOLERANCE must be greater than 0.");
+  static_assert(MIN_ARC_SEGMENT_TIME > 0, "MIN_ARC_SEGMENT_TIME must be greater than 0.");
+#endif
+
+/**
+ * Arcs as single planner blocks
+ */
+#if ENABLED(NATIVE_ARC_BLOCKS)
+  #if DISABLED(ARC_SUPPORT)
+    #error "NATIVE_ARC_BLOCKS requires ARC_SUPPORT."
+  #elif defined(__AVR__)
+    #error "NATIVE_ARC_BLOCKS requires a 32-bit processor."
+  #elif !defined(__ARM_FP)
+    #error "NATIVE_ARC_BLOCKS requires a processor with a hardware FPU, since the stepper ISR traces the arc in floating point."
+  #elif IS_KINEMATIC || IS_CORE
+    #error "NATIVE_ARC_BLOCKS requires a Cartesian machine."
+  #elif ENABLED(SKEW_CORRECTION)
+    #error "NATIVE_ARC_BLOCKS is incompatible with SKEW_CORRECTION."
+  #endif
+#endif
+
+/**
+ * G5 curve flattening
+ */
+#if ENABLED(BEZIER_CURVE_SUPPORT) && defined(BEZIER_TOLERANCE)
+  static_assert(BEZIER_TOLERANCE > 0, "BEZIER_TOLERANCE must be greater than 0.");
+#endif
+
+/**
+ * Jerk-limited S-curve planning
+ */
+#ifdef S_CURVE_JERK_LIMIT
+  #if DISABLED(S_CURVE_ACCELERATION)
+    #error "S_CURVE_JERK_LIMIT requires S_CURVE_ACCELERATION."
+  #endif
+  static_assert(S_CURVE_JERK_LIMIT > 0, "S_CURVE_JERK_LIMIT must be greater than 0.");
+#endif
+
+/**
+ * Path blending
+ */
+#if ENABLED(PATH_BLENDING)
+  static_assert(PATH_BLEND_TOLERANCE >= 0, "PATH_BLEND_TOLERANCE must be 0 or greater.");
+  static_assert(PATH_MERGE_TOLERANCE >= 0, "PATH_MERGE_TOLERANCE must be 0 or greater.");
+  #if !WITHIN(PATH_MERGE_POINTS, 1, 255)
+    #error "PATH_MERGE_POINTS must be from 1 to 255."
+  #endif
+#endif
+
+/**
+ * Parallel homing
+ */
+#if ENABLED(PARALLEL_HOMING)
+  #if IS_KINEMATIC || IS_CORE
+    #error "PARALLEL_HOMING requires a Cartesian machine."
+  #elif ENABLED(DUAL_X_CARRIAGE)
+    #error "PARALLEL_HOMING is incompatible with DUAL_X_CARRIAGE."
+  #elif ENABLED(X_DUAL_ENDSTOPS) || ENABLED(Y_DUAL_ENDSTOPS)
+    #error "PARALLEL_HOMING is incompatible with X_DUAL_ENDSTOPS and Y_DUAL_ENDSTOPS."
+  #elif ENABLED(SENSORLESS_HOMING)
+    #error "PARALLEL_HOMING requires physical X and Y endstops. Disable SENSORLESS_HOMING."
+  #elif ENABLED(INPUT_SHAPING)
+    #error "PARALLEL_HOMING is incompatible with INPUT_SHAPING."
+  #endif
+#endif
+
+/**
+ * Delta line interpolation
+ */
+#if ENABLED(DELTA_INTERPOLATION)
+  #if DISABLED(DELTA)
+    #error "DELTA_INTERPOLATION requires DELTA."
+  #elif ENABLED(SKEW_CORRECTION)
+    #error "DELTA_INTERPOLATION is incompatible with SKEW_CORRECTION."
+  #endif
+  static_assert(DELTA_INTERPOLATION_ERROR > 0, "DELTA_INTERPOLATION_ERROR must be greater than 0.");
+#endif
+
+/**
+ * Input shaping
+ */
+#if ENABLED(INPUT_SHAPING)
+  #ifdef __AVR__
+    #error "INPUT_SHAPING requires a 32-bit processor."
+  #elif IS_KINEMATIC || IS_CORE
+    #error "INPUT_SHAPING requires a Cartesian machine."
+  #elif !HAS_X_STEP || !HAS_Y_STEP
+    #error "INPUT_SHAPING requires X and Y stepper pins."
+  #elif !WITHIN(SHAPING_BUFFER_SIZE, 16, 65535)
+    #error "SHAPING_BUFFER_SIZE must be from 16 to 65535."
+  #endif
+  static_assert(SHAPING_FREQ_X >= 0 && SHAPING_FREQ_Y >= 0, "SHAPING_FREQ_[XY] must be 0 or greater.");
+  static_assert(WITHIN(SHAPING_DAMPING_X, 0, 0.99) && WITHIN(SHAPING_DAMPING_Y, 0, 0.99), "SHAPING_DAMPING_[XY] must be from 0 to 0.99.");
+#endif
+
 /**
  * Parking Extruder requirements
  */
@@ -1016,6 +1146,16 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     #error "MULTIPLE_PROBING must be >= 2."
   #endif
 
+  #if ENABLED(ADAPTIVE_PROBING)
+    #if ADAPTIVE_PROBING_MIN_SAMPLES < 2
+      #error "ADAPTIVE_PROBING_MIN_SAMPLES must be >= 2."
+    #elif ADAPTIVE_PROBING_MAX_SAMPLES < ADAPTIVE_PROBING_MIN_SAMPLES
+      #error "ADAPTIVE_PROBING_MAX_SAMPLES must be >= ADAPTIVE_PROBING_MIN_SAMPLES."
+    #elif ADAPTIVE_PROBING_MAX_SAMPLES > 50
+      #error "ADAPTIVE_PROBING_MAX_SAMPLES must be <= 50."
+    #endif
+  #endif
+
   #if Z_PROBE_LOW_POINT > 0
     #error "Z_PROBE_LOW_POINT must be less than or equal to 0."
   #endif
@@ -1033,6 +1173,10 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     #error "Z_MIN_PROBE_REPEATABILITY_TEST requires a probe: FIX_MOUNTED_PROBE, BLTOUCH, SOLENOID_PROBE, Z_PROBE_ALLEN_KEY, Z_PROBE_SLED, or Z Servo."
   #endif
 
+  #if ENABLED(ADAPTIVE_PROBING)
+    #error "ADAPTIVE_PROBING requires a probe: FIX_MOUNTED_PROBE, BLTOUCH, SOLENOID_PROBE, Z_PROBE_ALLEN_KEY, Z_PROBE_SLED, or Z Servo."
+  #endif
+
 #endif
 
 /**
@@ -1139,6 +1283,35 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "G29_RETRY_AND_RECOVER currently only supports ABL"
 #endif
 
+#if ENABLED(MESH_STORAGE_SLOTS)
+  #if DISABLED(EEPROM_SETTINGS)
+    #error "MESH_STORAGE_SLOTS requires EEPROM_SETTINGS."
+  #elif DISABLED(AUTO_BED_LEVELING_BILINEAR) && DISABLED(MESH_BED_LEVELING)
+    #error "MESH_STORAGE_SLOTS requires AUTO_BED_LEVELING_BILINEAR or MESH_BED_LEVELING."
+  #endif
+#endif
+
+#if ENABLED(MESH_THERMAL_COMPENSATION)
+  #if DISABLED(AUTO_BED_LEVELING_BILINEAR)
+    #error "MESH_THERMAL_COMPENSATION requires AUTO_BED_LEVELING_BILINEAR."
+  #elif !HAS_HEATED_BED
+    #error "MESH_THERMAL_COMPENSATION requires a heated bed."
+  #elif !HAS_BED_PROBE
+    #error "MESH_THERMAL_COMPENSATION requires a probe."
+  #endif
+  static_assert(MESH_THERMAL_RESOLUTION > 0, "MESH_THERMAL_RESOLUTION must be greater than 0.");
+#endif
+
+#if ENABLED(G29_PROBE_PRINT_AREA)
+  #if DISABLED(AUTO_BED_LEVELING_BILINEAR)
+    #error "G29_PROBE_PRINT_AREA requires AUTO_BED_LEVELING_BILINEAR."
+  #elif ENABLED(PROBE_MANUALLY)
+    #error "G29_PROBE_PRINT_AREA is not compatible with PROBE_MANUALLY."
+  #elif G29_PRINT_AREA_MARGIN < 0
+    #error "G29_PRINT_AREA_MARGIN must be greater than or equal to 0."
+  #endif
+#endif
+
 /**
  * LCD_BED_LEVELING requirements
  */
@@ -1973,6 +2146,22 @@ static_assert(sanity_arr_3[0] > 0 && sanity_arr_3[1] > 0 && sanity_arr_3[2] > 0
   #error "POWER_LOSS_RECOVERY currently requires an LCD Controller."
 #endif
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+  #if DISABLED(POWER_LOSS_RECOVERY)
+    #error "POWER_LOSS_JOURNAL requires POWER_LOSS_RECOVERY."
+  #elif !WITHIN(POWER_LOSS_JOURNAL_RECORDS, 2, 255)
+    #error "POWER_LOSS_JOURNAL_RECORDS must be from 2 to 255."
+  #endif
+#endif
+
+#if ENABLED(POWER_LOSS_EXACT_RESUME)
+  #if DISABLED(POWER_LOSS_JOURNAL)
+    #error "POWER_LOSS_EXACT_RESUME requires POWER_LOSS_JOURNAL."
+  #elif ENABLED(PATH_BLENDING)
+    #error "POWER_LOSS_EXACT_RESUME is incompatible with PATH_BLENDING."
+  #endif
+#endif
+
 #if ENABLED(FAST_PWM_FAN) && !(defined(ARDUINO) && !defined(ARDUINO_ARCH_SAM))
   #error "FAST_PWM_FAN only supported by 8 bit CPUs."
 #endif
@@ -1993,10 +2182,24 @@ static_assert(sanity_arr_3[0] > 0 && sanity_arr_3[1] > 0 && sanity_arr_3[2] > 0
 #if ENABLED(PRINTCOUNTER) && DISABLED(EEPROM_SETTINGS)
   #error "PRINTCOUNTER requires EEPROM_SETTINGS. Please update your Configuration."
 #endif
+#if ENABLED(PRINTCOUNTER_MAINTENANCE)
+  #if DISABLED(PRINTCOUNTER)
+    #error "PRINTCOUNTER_MAINTENANCE requires PRINTCOUNTER."
+  #elif !WITHIN(PRINTCOUNTER_SLOTS, 2, 16)
+    #error "PRINTCOUNTER_SLOTS must be from 2 to 16."
+  #endif
+#endif
 
 #if ENABLED(USB_FLASH_DRIVE_SUPPORT) && !(PIN_EXISTS(USB_CS) && PIN_EXISTS(USB_INTR))
   #error "USB_CS_PIN and USB_INTR_PIN are required for USB_FLASH_DRIVE_SUPPORT."
 #endif
+#ifdef USB_READ_AHEAD_BLOCKS
+  #ifdef __AVR__
+    #error "USB_READ_AHEAD_BLOCKS (512 bytes of RAM per block) is not supported on AVR."
+  #elif !WITHIN(USB_READ_AHEAD_BLOCKS, 2, 64)
+    #error "USB_READ_AHEAD_BLOCKS must be from 2 to 64."
+  #endif
+#endif
 
 #if ENABLED(SD_FIRMWARE_UPDATE) && !defined(__AVR_ATmega2560__)
   #error "SD_FIRMWARE_UPDATE requires an ATmega2560-based (Arduino Mega) board."
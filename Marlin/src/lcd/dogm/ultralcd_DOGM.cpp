@@ -100,6 +100,13 @@ void MarlinUI::set_font(const MarlinFont font_nr) {
 
 #if ENABLED(SHOW_BOOTSCREEN)
 
+  #if ENABLED(FAST_BOOT)
+    // Hold the screen from MarlinUI::update() instead of blocking setup()
+    #define BOOTSCREEN_DELAY(MS) (ui.bootscreen_ms = millis() + (MS))
+  #else
+    #define BOOTSCREEN_DELAY(MS) safe_delay(MS)
+  #endif
+
   #if ENABLED(SHOW_CUSTOM_BOOTSCREEN)
 
     #ifdef LULZBOT_CUSTOM_BOOTSCREEN
@@ -133,23 +140,57 @@ void MarlinUI::set_font(const MarlinFont font_nr) {
     }
     #endif
 
+    #if ENABLED(ANIMATED_BOOTSCREEN) && ENABLED(FAST_BOOT)
+      static uint8_t bootscreen_frame; // The next frame, drawn from MarlinUI::update()
+    #endif
+
     void lcd_custom_bootscreen() {
-      #if ENABLED(ANIMATED_BOOTSCREEN)
+      #if ENABLED(ANIMATED_BOOTSCREEN) && ENABLED(FAST_BOOT)
+        // Only the first frame is drawn here. MarlinUI::update() steps through the rest.
+        draw_custom_bootscreen((u8g_pgm_uint8_t*)pgm_read_ptr(&custom_bootscreen_animation[0]));
+        bootscreen_frame = 1;
+        BOOTSCREEN_DELAY(COUNT(custom_bootscreen_animation) > 1 ? CUSTOM_BOOTSCREEN_FRAME_TIME : CUSTOM_BOOTSCREEN_TIMEOUT);
+        return;
+      #elif ENABLED(ANIMATED_BOOTSCREEN)
         LOOP_L_N(f, COUNT(custom_bootscreen_animation)) {
-          if (f) safe_delay(CUSTOM_BOOTSCREEN_FRAME_TIME);
+          if (f) BOOTSCREEN_DELAY(CUSTOM_BOOTSCREEN_FRAME_TIME);
           draw_custom_bootscreen((u8g_pgm_uint8_t*)pgm_read_ptr(&custom_bootscreen_animation[f]), f == 0);
         }
       #else
         draw_custom_bootscreen(custom_start_bmp);
       #endif
-      safe_delay(CUSTOM_BOOTSCREEN_TIMEOUT);
+      BOOTSCREEN_DELAY(CUSTOM_BOOTSCREEN_TIMEOUT);
     }
 
   #endif // SHOW_CUSTOM_BOOTSCREEN
 
+  #if ENABLED(FAST_BOOT)
+
+    /**
+     * Called by MarlinUI::update() when the boot screen time runs out.
+     * Draw the next frame of an animated boot screen and return true
+     * to keep holding it, or return false when the boot screen is done.
+     */
+    bool MarlinUI::next_bootscreen_frame() {
+      #if ENABLED(SHOW_CUSTOM_BOOTSCREEN) && ENABLED(ANIMATED_BOOTSCREEN)
+        constexpr uint8_t frames = COUNT(custom_bootscreen_animation);
+        if (bootscreen_frame < frames) {
+          draw_custom_bootscreen((u8g_pgm_uint8_t*)pgm_read_ptr(&custom_bootscreen_animation[bootscreen_frame]), false);
+          BOOTSCREEN_DELAY(++bootscreen_frame < frames ? CUSTOM_BOOTSCREEN_FRAME_TIME : CUSTOM_BOOTSCREEN_TIMEOUT);
+          return true;
+        }
+      #endif
+      return false;
+    }
+
+  #endif
+
   void MarlinUI::show_bootscreen() {
     #if ENABLED(SHOW_CUSTOM_BOOTSCREEN)
       lcd_custom_bootscreen();
+      #if ENABLED(FAST_BOOT)
+        return; // Only one screen can be held, so skip the Marlin screen
+      #endif
     #endif
 
     constexpr uint8_t offy =
@@ -177,7 +218,7 @@ void MarlinUI::set_font(const MarlinFont font_nr) {
         u8g.drawStr(txt2X, height - (MENU_FONT_HEIGHT) * 1 / 2, STRING_SPLASH_LINE2);
       #endif
     } while (u8g.nextPage());
-    safe_delay(BOOTSCREEN_TIMEOUT);
+    BOOTSCREEN_DELAY(BOOTSCREEN_TIMEOUT);
   }
 
 #endif // SHOW_BOOTSCREEN
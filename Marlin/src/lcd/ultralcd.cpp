@@ -106,6 +106,10 @@
 
 uint8_t MarlinUI::lcd_status_update_delay = 1; // First update one loop delayed
 
+#if ENABLED(SHOW_BOOTSCREEN) && ENABLED(FAST_BOOT)
+  millis_t MarlinUI::bootscreen_ms; // = 0
+#endif
+
 #if ENABLED(FILAMENT_LCD_DISPLAY) && ENABLED(SDSUPPORT)
   millis_t MarlinUI::next_filament_display; // = 0
 #endif
@@ -730,6 +734,16 @@ void MarlinUI::update() {
   #endif // SDSUPPORT && SD_DETECT_PIN
 
   const millis_t ms = millis();
+
+  #if ENABLED(SHOW_BOOTSCREEN) && ENABLED(FAST_BOOT)
+    // Leave the boot screen up until it times out, animating it if needed
+    if (bootscreen_ms) {
+      if (PENDING(ms, bootscreen_ms) || next_bootscreen_frame()) return;
+      bootscreen_ms = 0;
+      refresh();
+    }
+  #endif
+
   if (ELAPSED(ms, next_lcd_update_ms)
     #if HAS_GRAPHICAL_LCD
       || drawing_screen
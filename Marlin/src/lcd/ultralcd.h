@@ -292,6 +292,10 @@ public:
 
       #if ENABLED(SHOW_BOOTSCREEN)
         static void show_bootscreen();
+        #if ENABLED(FAST_BOOT)
+          static millis_t bootscreen_ms;  // Keep the boot screen up until this time
+          static bool next_bootscreen_frame();
+        #endif
       #endif
 
       #if HAS_GRAPHICAL_LCD
@@ -0,0 +1,77 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * sample_stats.cpp - Statistics over a small set of probe samples
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(Z_MIN_PROBE_REPEATABILITY_TEST) || ENABLED(ADAPTIVE_PROBING)
+
+#include "sample_stats.h"
+
+/**
+ * Median of the samples. The array is sorted in place.
+ * Insertion sort is fine for the handful of samples taken per point.
+ */
+float samples_median(float s[], const uint8_t n) {
+  if (!n) return NAN;
+  for (uint8_t i = 1; i < n; i++) {
+    const float v = s[i];
+    uint8_t j = i;
+    for (; j && s[j - 1] > v; j--) s[j] = s[j - 1];
+    s[j] = v;
+  }
+  return (n & 1) ? s[n / 2] : (s[n / 2 - 1] + s[n / 2]) * 0.5f;
+}
+
+/**
+ * Median absolute deviation of the samples about the given median
+ */
+float samples_mad(const float s[], const uint8_t n, const float &median) {
+  if (!n) return NAN;
+  float dev[n];
+  for (uint8_t i = 0; i < n; i++) dev[i] = ABS(s[i] - median);
+  return samples_median(dev, n);
+}
+
+/**
+ * Mean of the samples lying within k scaled MADs of the median.
+ * The limit is never tighter than min_limit, so samples that differ
+ * only by a step or two are all kept. Statistics of the kept samples
+ * are returned in 'kept'. The array is sorted in place.
+ */
+float samples_robust_mean(float s[], const uint8_t n, const float &k, const float &min_limit, sample_stats &kept) {
+  kept.reset();
+  if (!n) return NAN;
+
+  const float median = samples_median(s, n),
+              limit = MAX(k * 1.4826f * samples_mad(s, n, median), min_limit); // 1.4826 * MAD estimates sigma
+
+  for (uint8_t i = 0; i < n; i++)
+    if (ABS(s[i] - median) <= limit) kept.add(s[i]);
+
+  return kept.count ? kept.mean : median;
+}
+
+#endif // Z_MIN_PROBE_REPEATABILITY_TEST || ADAPTIVE_PROBING
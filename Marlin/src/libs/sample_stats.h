@@ -0,0 +1,62 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * sample_stats.h - Statistics over a small set of probe samples
+ *
+ * Running mean and standard deviation use Welford's method, so samples
+ * can be added one at a time and the spread checked after each one.
+ * The median / MAD helpers allow outlying samples to be rejected.
+ *
+ * Shared by M48 and ADAPTIVE_PROBING.
+ */
+
+#include "../inc/MarlinConfig.h"
+#include <math.h>
+
+struct sample_stats {
+  float mean, m2, min, max;
+  uint8_t count;
+
+  sample_stats() { reset(); }
+
+  void reset() { mean = m2 = 0; min = 99999.9; max = -99999.9; count = 0; }
+
+  void add(const float &v) {
+    count++;
+    const float d = v - mean;
+    mean += d / count;
+    m2 += d * (v - mean);
+    NOMORE(min, v);
+    NOLESS(max, v);
+  }
+
+  // Population standard deviation of the samples added so far
+  float sigma() const { return count ? SQRT(m2 / count) : 0; }
+
+  float range() const { return count ? max - min : 0; }
+};
+
+float samples_median(float s[], const uint8_t n);
+float samples_mad(const float s[], const uint8_t n, const float &median);
+float samples_robust_mean(float s[], const uint8_t n, const float &k, const float &min_limit, sample_stats &kept);
@@ -36,16 +36,20 @@
  *
  */
 
+#include "configuration_store.h"
+
 // Change EEPROM version if the structure changes
-#define EEPROM_VERSION "V64"
+#if ENABLED(PRINTCOUNTER_MAINTENANCE)
+  #define EEPROM_VERSION "P65" // The statistics ring moves the mesh slots down
+#else
+  #define EEPROM_VERSION "V65"
+#endif
 #define EEPROM_OFFSET 100
 
 // Check the integrity of data offsets.
 // Can be disabled for production build.
 //#define DEBUG_EEPROM_READWRITE
 
-#include "configuration_store.h"
-
 #if ADD_PORT_ARG
   #define PORTARG_SOLO     const int8_t port
   #define PORTARG_BEFORE   const int8_t port,
@@ -78,6 +82,10 @@
   #include "../feature/bedlevel/bedlevel.h"
 #endif
 
+#if ENABLED(MESH_THERMAL_COMPENSATION)
+  #include "../feature/bedlevel/abl/mesh_thermal.h"
+#endif
+
 #if HAS_SERVOS
   #include "servo.h"
 #endif
@@ -98,6 +106,10 @@
   #include "../feature/power_loss_recovery.h"
 #endif
 
+#if ENABLED(PRINTCOUNTER_MAINTENANCE)
+  #include "printcounter.h"
+#endif
+
 #include "../feature/pause.h"
 
 #if EXTRUDERS > 1
@@ -295,6 +307,13 @@ typedef struct SettingsDataStruct {
     toolchange_settings_t toolchange_settings;          // M217 S P R
   #endif
 
+  //
+  // MESH_THERMAL_COMPENSATION
+  //
+  #if ENABLED(MESH_THERMAL_COMPENSATION)
+    mesh_thermal_t mesh_thermal_data;                   // G76 S
+  #endif
+
 } SettingsData;
 
 MarlinSettings settings;
@@ -428,7 +447,11 @@ void MarlinSettings::postprocess() {
   #define EEPROM_START() int eeprom_index = EEPROM_OFFSET; persistentStore.access_start()
   #define EEPROM_FINISH() persistentStore.access_finish()
   #define EEPROM_SKIP(VAR) eeprom_index += sizeof(VAR)
-  #define EEPROM_WRITE(VAR) persistentStore.write_data(eeprom_index, (uint8_t*)&VAR, sizeof(VAR), &working_crc)
+  #if ENABLED(EEPROM_INVALIDATE_ON_CHANGE)
+    #define EEPROM_WRITE(VAR) write_changed(eeprom_index, (uint8_t*)&VAR, sizeof(VAR), &working_crc)
+  #else
+    #define EEPROM_WRITE(VAR) persistentStore.write_data(eeprom_index, (uint8_t*)&VAR, sizeof(VAR), &working_crc)
+  #endif
   #define EEPROM_READ(VAR) persistentStore.read_data(eeprom_index, (uint8_t*)&VAR, sizeof(VAR), &working_crc, !validating)
   #define EEPROM_READ_ALWAYS(VAR) persistentStore.read_data(eeprom_index, (uint8_t*)&VAR, sizeof(VAR), &working_crc)
   #define EEPROM_ASSERT(TST,ERR) do{ if (!(TST)) { SERIAL_ERROR_MSG_P(port, ERR); eeprom_error = true; } }while(0)
@@ -447,6 +470,10 @@ void MarlinSettings::postprocess() {
 
   bool MarlinSettings::eeprom_error, MarlinSettings::validating;
 
+  #if ENABLED(EEPROM_INVALIDATE_ON_CHANGE)
+    bool MarlinSettings::eeprom_invalidated;
+  #endif
+
   bool MarlinSettings::size_error(const uint16_t size PORTARG_AFTER) {
     if (size != datasize()) {
       CHITCHAT_ERROR_MSG_P(port, "EEPROM datasize error.");
@@ -455,6 +482,33 @@ void MarlinSettings::postprocess() {
     return false;
   }
 
+  #if ENABLED(EEPROM_INVALIDATE_ON_CHANGE)
+
+    /**
+     * Write data, first invalidating the stored settings if any
+     * byte of it differs from the stored copy.
+     */
+    void MarlinSettings::write_changed(int &pos, const uint8_t *value, size_t size, uint16_t *crc) {
+      if (!eeprom_invalidated) {
+        int stored_pos = pos;
+        uint16_t stored_crc = 0;
+        for (size_t i = 0; i < size; i++) {
+          uint8_t stored;
+          persistentStore.read_data(stored_pos, &stored, 1, &stored_crc);
+          if (stored != value[i]) {
+            const char ver[4] = "ERR";
+            int ver_pos = EEPROM_OFFSET;
+            persistentStore.write_data(ver_pos, (uint8_t*)ver, sizeof(ver), &stored_crc);
+            eeprom_invalidated = true;
+            break;
+          }
+        }
+      }
+      persistentStore.write_data(pos, value, size, crc);
+    }
+
+  #endif
+
   LULZBOT_SAVE_ZOFFSET_TO_EEPROM_IMPL
 
   /**
@@ -471,6 +525,9 @@ void MarlinSettings::postprocess() {
     eeprom_error = false;
     #if ENABLED(FLASH_EEPROM_EMULATION)
       EEPROM_SKIP(ver);   // Flash doesn't allow rewriting without erase
+    #elif ENABLED(EEPROM_INVALIDATE_ON_CHANGE)
+      eeprom_invalidated = false;
+      EEPROM_SKIP(ver);   // invalidate data before the first changed byte
     #else
       EEPROM_WRITE(ver);  // invalidate data first
     #endif
@@ -1115,6 +1172,14 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(toolchange_settings);
     #endif
 
+    //
+    // Mesh bed temperature compensation
+    //
+    #if ENABLED(MESH_THERMAL_COMPENSATION)
+      _FIELD_TEST(mesh_thermal_data);
+      EEPROM_WRITE(mesh_thermal.data);
+    #endif
+
     //
     // Validate CRC and Data Size
     //
@@ -1125,6 +1190,9 @@ void MarlinSettings::postprocess() {
       // Write the EEPROM header
       eeprom_index = EEPROM_OFFSET;
 
+      #if ENABLED(EEPROM_INVALIDATE_ON_CHANGE)
+        eeprom_invalidated = true; // The header is written last
+      #endif
       EEPROM_WRITE(version);
       EEPROM_WRITE(final_crc);
 
@@ -1332,6 +1400,9 @@ void MarlinSettings::postprocess() {
             EEPROM_READ(bilinear_grid_spacing);        // 2 ints
             EEPROM_READ(bilinear_start);               // 2 ints
             EEPROM_READ(z_values);                     // 9 to 256 floats
+            #if ENABLED(ADAPTIVE_PROBING)
+              if (!validating) memset(z_sigma, 0xFF, sizeof(z_sigma)); // Spread is not stored
+            #endif
           }
           else // EEPROM data is stale
         #endif // AUTO_BED_LEVELING_BILINEAR
@@ -1837,6 +1908,14 @@ void MarlinSettings::postprocess() {
         EEPROM_READ(toolchange_settings);
       #endif
 
+      //
+      // Mesh bed temperature compensation
+      //
+      #if ENABLED(MESH_THERMAL_COMPENSATION)
+        _FIELD_TEST(mesh_thermal_data);
+        EEPROM_READ(mesh_thermal.data);
+      #endif
+
       eeprom_error = size_error(eeprom_index - (EEPROM_OFFSET));
       if (eeprom_error) {
         CHITCHAT_ECHO_START_P(port);
@@ -1912,14 +1991,19 @@ void MarlinSettings::postprocess() {
   }
 
   bool MarlinSettings::load(PORTARG_SOLO) {
-    if (validate(PORTVAR_SOLO)) return _load(PORTVAR_SOLO);
+    #if ENABLED(FAST_BOOT) && DISABLED(AUTO_BED_LEVELING_UBL)
+      // Load in a single pass. A CRC error leaves partial data, so reset.
+      if (_load(PORTVAR_SOLO)) return true;
+    #else
+      if (validate(PORTVAR_SOLO)) return _load(PORTVAR_SOLO);
+    #endif
     reset();
     return true;
   }
 
-  #if ENABLED(AUTO_BED_LEVELING_UBL)
+  #if ENABLED(AUTO_BED_LEVELING_UBL) || ENABLED(MESH_STORAGE_SLOTS)
 
-    inline void ubl_invalid_slot(const int s) {
+    inline void mesh_invalid_slot(const int s) {
       #if ENABLED(EEPROM_CHITCHAT)
         CHITCHAT_ECHOLNPGM("?Invalid slot.");
         CHITCHAT_ECHO(s);
@@ -1929,9 +2013,127 @@ void MarlinSettings::postprocess() {
       #endif
     }
 
-    const uint16_t MarlinSettings::meshes_end = persistentStore.capacity() - 129; // 128 (+1 because of the change to capacity rather than last valid address)
+    #if ENABLED(MESH_STORAGE_SLOTS)
+
+      /**
+       * A stored mesh holds each point as a signed byte: the step from the
+       * previous point along a serpentine path, in units of 'quantum' microns.
+       * Steps are taken from the reconstructed previous point, so rounding
+       * never accumulates and every point is within quantum/2 of the original.
+       */
+      #define MESH_SLOT_NAN -128
+
+      typedef struct {
+        uint16_t crc;                       // CRC of the rest of the slot
+        uint8_t grid_x, grid_y;             // Must match GRID_MAX_POINTS_X/Y
+        int16_t start[2], spacing[2];       // Bilinear grid geometry
+        int16_t first;                      // First stored point (microns)
+        uint8_t quantum;                    // Size of one step (microns)
+        #if ENABLED(MESH_THERMAL_COMPENSATION)
+          int16_t temp;                     // Bed temperature the mesh applies to (0.1°C)
+        #endif
+        int8_t step[GRID_MAX_POINTS];
+      } mesh_slot_t;
+
+      #define MESH_SLOT_SIZE sizeof(mesh_slot_t)
+
+      // Serpentine order keeps neighboring points adjacent in the stream
+      static inline float& mesh_slot_z(const uint16_t n) {
+        const uint8_t y = n / (GRID_MAX_POINTS_X), i = n % (GRID_MAX_POINTS_X),
+                      x = (y & 1) ? (GRID_MAX_POINTS_X) - 1 - i : i;
+        return Z_VALUES(x, y);
+      }
+
+      static bool encode_mesh_slot(mesh_slot_t &ms) {
+        // The largest step between stored neighbors sets the quantum
+        float prev = NAN, first = NAN, max_step = 0;
+        for (uint16_t n = 0; n < GRID_MAX_POINTS; n++) {
+          const float z = mesh_slot_z(n);
+          if (isnan(z)) continue;
+          if (isnan(prev)) first = z; else NOLESS(max_step, ABS(z - prev));
+          prev = z;
+        }
+        if (isnan(first) || !WITHIN(first, -32.0f, 32.0f)) return false;
+
+        const uint16_t quantum = CEIL((max_step * 1000 + 1) / 126);
+        if (quantum > 255) return false;
+
+        ms.grid_x = GRID_MAX_POINTS_X;
+        ms.grid_y = GRID_MAX_POINTS_Y;
+        #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+          ms.start[X_AXIS] = bilinear_start[X_AXIS];
+          ms.start[Y_AXIS] = bilinear_start[Y_AXIS];
+          ms.spacing[X_AXIS] = bilinear_grid_spacing[X_AXIS];
+          ms.spacing[Y_AXIS] = bilinear_grid_spacing[Y_AXIS];
+        #else
+          ms.start[X_AXIS] = ms.start[Y_AXIS] = ms.spacing[X_AXIS] = ms.spacing[Y_AXIS] = 0;
+        #endif
+        ms.first = LROUND(first * 1000);
+        ms.quantum = quantum;
+        #if ENABLED(MESH_THERMAL_COMPENSATION)
+          ms.temp = LROUND(mesh_thermal.data.temp * 10);
+        #endif
+
+        int32_t recon = ms.first;
+        for (uint16_t n = 0; n < GRID_MAX_POINTS; n++) {
+          const float z = mesh_slot_z(n);
+          if (isnan(z)) { ms.step[n] = MESH_SLOT_NAN; continue; }
+          const int16_t d = constrain(LROUND((z * 1000 - recon) / quantum), -127, 127);
+          ms.step[n] = d;
+          recon += int32_t(d) * quantum;
+        }
+
+        ms.crc = 0;
+        crc16(&ms.crc, &ms.grid_x, MESH_SLOT_SIZE - sizeof(ms.crc));
+        return true;
+      }
+
+      static bool decode_mesh_slot(const mesh_slot_t &ms) {
+        uint16_t crc = 0;
+        crc16(&crc, &ms.grid_x, MESH_SLOT_SIZE - sizeof(ms.crc));
+        if (ms.grid_x != GRID_MAX_POINTS_X || ms.grid_y != GRID_MAX_POINTS_Y || crc != ms.crc || !ms.quantum)
+          return false;
+
+        #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+          bilinear_start[X_AXIS] = ms.start[X_AXIS];
+          bilinear_start[Y_AXIS] = ms.start[Y_AXIS];
+          bilinear_grid_spacing[X_AXIS] = ms.spacing[X_AXIS];
+          bilinear_grid_spacing[Y_AXIS] = ms.spacing[Y_AXIS];
+        #endif
+
+        int32_t recon = ms.first;
+        for (uint16_t n = 0; n < GRID_MAX_POINTS; n++) {
+          if (ms.step[n] == MESH_SLOT_NAN) { mesh_slot_z(n) = NAN; continue; }
+          recon += int32_t(ms.step[n]) * ms.quantum;
+          mesh_slot_z(n) = recon * 0.001f;
+        }
+
+        #if ENABLED(MESH_THERMAL_COMPENSATION)
+          mesh_thermal.set_reference(ms.temp * 0.1f);
+        #endif
+
+        #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+          #if ENABLED(ADAPTIVE_PROBING)
+            memset(z_sigma, 0xFF, sizeof(z_sigma)); // Spread is not stored
+          #endif
+          refresh_bed_level();
+        #endif
+        return true;
+      }
+
+    #else
+
+      #define MESH_SLOT_SIZE sizeof(ubl.z_values)
+
+    #endif
+
+    const uint16_t MarlinSettings::meshes_end = persistentStore.capacity() - 129  // 128 (+1 because of the change to capacity rather than last valid address)
                                                                                   // is a placeholder for the size of the MAT; the MAT will always
                                                                                   // live at the very end of the eeprom
+      #if ENABLED(PRINTCOUNTER_MAINTENANCE)
+        - STATS_RING_SIZE                                                         // Print statistics sit just below the MAT
+      #endif
+    ;
 
     uint16_t MarlinSettings::meshes_start_index() {
       return (datasize() + EEPROM_OFFSET + 32) & 0xFFF8;  // Pad the end of configuration data so it can float up
@@ -1939,79 +2141,100 @@ void MarlinSettings::postprocess() {
     }
 
     uint16_t MarlinSettings::calc_num_meshes() {
-      return (meshes_end - meshes_start_index()) / sizeof(ubl.z_values);
+      return (meshes_end - meshes_start_index()) / MESH_SLOT_SIZE;
     }
 
     int MarlinSettings::mesh_slot_offset(const int8_t slot) {
-      return meshes_end - (slot + 1) * sizeof(ubl.z_values);
+      return meshes_end - (slot + 1) * MESH_SLOT_SIZE;
     }
 
-    void MarlinSettings::store_mesh(const int8_t slot) {
+    bool MarlinSettings::store_mesh(const int8_t slot) {
 
-      #if ENABLED(AUTO_BED_LEVELING_UBL)
-        const int16_t a = calc_num_meshes();
-        if (!WITHIN(slot, 0, a - 1)) {
-          ubl_invalid_slot(a);
-          CHITCHAT_ECHOPAIR("E2END=", persistentStore.capacity() - 1);
-          CHITCHAT_ECHOPAIR(" meshes_end=", meshes_end);
-          CHITCHAT_ECHOLNPAIR(" slot=", slot);
-          CHITCHAT_EOL();
-          return;
-        }
+      const int16_t a = calc_num_meshes();
+      if (!WITHIN(slot, 0, a - 1)) {
+        mesh_invalid_slot(a);
+        CHITCHAT_ECHOPAIR("E2END=", persistentStore.capacity() - 1);
+        CHITCHAT_ECHOPAIR(" meshes_end=", meshes_end);
+        CHITCHAT_ECHOLNPAIR(" slot=", slot);
+        CHITCHAT_EOL();
+        return false;
+      }
 
-        int pos = mesh_slot_offset(slot);
-        uint16_t crc = 0;
+      int pos = mesh_slot_offset(slot);
+      uint16_t crc = 0;
+
+      #if ENABLED(AUTO_BED_LEVELING_UBL)
 
         // Write crc to MAT along with other data, or just tack on to the beginning or end
         persistentStore.access_start();
         const bool status = persistentStore.write_data(pos, (uint8_t *)&ubl.z_values, sizeof(ubl.z_values), &crc);
         persistentStore.access_finish();
 
-        if (status) SERIAL_ECHOPGM("?Unable to save mesh data.\n");
-        else        CHITCHAT_ECHOLNPAIR("Mesh saved in slot ", slot);
-
       #else
 
-        // Other mesh types
+        mesh_slot_t ms;
+        if (!encode_mesh_slot(ms)) {
+          SERIAL_ECHOLNPGM("?Mesh is empty or out of range.");
+          return false;
+        }
+
+        persistentStore.access_start();
+        const bool status = persistentStore.write_data(pos, (uint8_t *)&ms, sizeof(ms), &crc);
+        persistentStore.access_finish();
 
       #endif
+
+      if (status) SERIAL_ECHOPGM("?Unable to save mesh data.\n");
+      else        CHITCHAT_ECHOLNPAIR("Mesh saved in slot ", slot);
+
+      return !status;
     }
 
-    void MarlinSettings::load_mesh(const int8_t slot, void * const into/*=NULL*/) {
+    bool MarlinSettings::load_mesh(const int8_t slot, void * const into/*=NULL*/) {
 
-      #if ENABLED(AUTO_BED_LEVELING_UBL)
+      const int16_t a = settings.calc_num_meshes();
 
-        const int16_t a = settings.calc_num_meshes();
+      if (!WITHIN(slot, 0, a - 1)) {
+        mesh_invalid_slot(a);
+        return false;
+      }
 
-        if (!WITHIN(slot, 0, a - 1)) {
-          ubl_invalid_slot(a);
-          return;
-        }
+      int pos = mesh_slot_offset(slot);
+      uint16_t crc = 0;
+
+      #if ENABLED(AUTO_BED_LEVELING_UBL)
 
-        int pos = mesh_slot_offset(slot);
-        uint16_t crc = 0;
         uint8_t * const dest = into ? (uint8_t*)into : (uint8_t*)&ubl.z_values;
 
         persistentStore.access_start();
         const uint16_t status = persistentStore.read_data(pos, dest, sizeof(ubl.z_values), &crc);
         persistentStore.access_finish();
 
-        if (status) SERIAL_ECHOPGM("?Unable to load mesh data.\n");
-        else        CHITCHAT_ECHOLNPAIR("Mesh loaded from slot ", slot);
+      #else
 
-        EEPROM_FINISH();
+        UNUSED(into);
+        mesh_slot_t ms;
 
-      #else
+        persistentStore.access_start();
+        uint16_t status = persistentStore.read_data(pos, (uint8_t *)&ms, sizeof(ms), &crc);
+        persistentStore.access_finish();
 
-        // Other mesh types
+        // The active mesh is only replaced by a valid slot
+        if (!status && !decode_mesh_slot(ms)) status = true;
 
       #endif
+
+      if (status) SERIAL_ECHOPGM("?Unable to load mesh data.\n");
+      else        CHITCHAT_ECHOLNPAIR("Mesh loaded from slot ", slot);
+
+      EEPROM_FINISH();
+      return !status;
     }
 
     //void MarlinSettings::delete_mesh() { return; }
     //void MarlinSettings::defrag_meshes() { return; }
 
-  #endif // AUTO_BED_LEVELING_UBL
+  #endif // AUTO_BED_LEVELING_UBL || MESH_STORAGE_SLOTS
 
 #else // !EEPROM_SETTINGS
 
@@ -2096,6 +2319,10 @@ void MarlinSettings::reset(PORTARG_SOLO) {
     reset_bed_level();
   #endif
 
+  #if ENABLED(MESH_THERMAL_COMPENSATION)
+    mesh_thermal.reset();
+  #endif
+
   #if HAS_BED_PROBE
     zprobe_zoffset = Z_PROBE_OFFSET_FROM_EXTRUDER;
   #endif
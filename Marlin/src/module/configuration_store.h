@@ -25,6 +25,11 @@
 
 #if ENABLED(EEPROM_SETTINGS)
   #include "../HAL/shared/persistent_store_api.h"
+  // Byte-wise EEPROM only writes changed bytes, so an unchanged
+  // save can also skip invalidating the stored settings
+  #if defined(__AVR__) || ENABLED(I2C_EEPROM) || ENABLED(SPI_EEPROM)
+    #define EEPROM_INVALIDATE_ON_CHANGE
+  #endif
 #endif
 
 #define ADD_PORT_ARG ENABLED(EEPROM_CHITCHAT) && NUM_SERIAL > 1
@@ -68,14 +73,13 @@ class MarlinSettings {
       static bool load(PORTINIT_SOLO);      // Return 'true' if data was loaded ok
       static bool validate(PORTINIT_SOLO);  // Return 'true' if EEPROM data is ok
 
-      #if ENABLED(AUTO_BED_LEVELING_UBL) // Eventually make these available if any leveling system
-                                         // That can store is enabled
+      #if ENABLED(AUTO_BED_LEVELING_UBL) || ENABLED(MESH_STORAGE_SLOTS)
         static uint16_t meshes_start_index();
         FORCE_INLINE static uint16_t meshes_end_index() { return meshes_end; }
         static uint16_t calc_num_meshes();
         static int mesh_slot_offset(const int8_t slot);
-        static void store_mesh(const int8_t slot);
-        static void load_mesh(const int8_t slot, void * const into=NULL);
+        static bool store_mesh(const int8_t slot);                  // Return 'true' if the mesh was saved
+        static bool load_mesh(const int8_t slot, void * const into=NULL); // Return 'true' if the mesh was loaded
 
         //static void delete_mesh();    // necessary if we have a MAT
         //static void defrag_meshes();  // "
@@ -105,13 +109,16 @@ class MarlinSettings {
 
       static bool eeprom_error, validating;
 
-      #if ENABLED(AUTO_BED_LEVELING_UBL)  // Eventually make these available if any leveling system
-                                          // That can store is enabled
+      #if ENABLED(AUTO_BED_LEVELING_UBL) || ENABLED(MESH_STORAGE_SLOTS)
         static const uint16_t meshes_end; // 128 is a placeholder for the size of the MAT; the MAT will always
                                           // live at the very end of the eeprom
       #endif
 
       static bool _load(PORTINIT_SOLO);
+      #if ENABLED(EEPROM_INVALIDATE_ON_CHANGE)
+        static bool eeprom_invalidated;
+        static void write_changed(int &pos, const uint8_t *value, size_t size, uint16_t *crc);
+      #endif
       static bool size_error(const uint16_t size PORTINIT_AFTER);
     #endif
 };
@@ -118,6 +118,119 @@ void inverse_kinematics(const float (&raw)[XYZ]) {
   #endif
 }
 
+#if ENABLED(DELTA_INTERPOLATION)
+
+  /**
+   * Delta Line Interpolation
+   *
+   * Along a straight line each carriage sits at the effector Z plus
+   * SQRT(Q(k)), where Q is a quadratic in the segment number k. So
+   * the square roots are only taken at the ends of spans of segments,
+   * along with their slopes (the Jacobian of each tower along the line).
+   * In between, the offsets follow the cubic Hermite curve through those
+   * values, stepped by forward differences: three additions per tower.
+   *
+   * The error of the cubic over a span of n segments is at most
+   * n^4 / 384 * |s''''|. The 4th derivative is taken at the start of
+   * each span and doubled for margin, which sets the span length for
+   * DELTA_INTERPOLATION_ERROR.
+   */
+
+  // Spans are also kept short enough for the float sums to stay exact
+  #define DELTA_SPAN_MAX 64
+
+  static float dl_a,                              // Quadratic term, the same for every tower
+               dl_b[ABC], dl_c[ABC],              // Linear and constant terms
+               dl_end[ABC], dl_slope[ABC],        // Exact offsets and slopes at the end of the span
+               dl_tower[ABC],                     // Interpolated offsets
+               dl_d1[ABC], dl_d2[ABC], dl_d3[ABC]; // Forward differences
+  static uint16_t dl_k, dl_span_end, dl_segments;
+
+  // The exact tower offsets and slopes at segment k
+  static void delta_line_exact(const float k, float (&s)[ABC], float (&ds)[ABC]) {
+    LOOP_L_N(i, ABC) {
+      s[i] = SQRT(dl_c[i] + k * (dl_b[i] + k * dl_a));
+      ds[i] = 0.5f * (dl_b[i] + 2 * k * dl_a) / s[i];
+    }
+  }
+
+  // Start a new span at the current segment
+  static void delta_line_span() {
+
+    // s'' = (a - s'^2) / s and s'''' = (12 s'^2 / s - 3 s'') s'' / s
+    float d4_max = 0;
+    LOOP_L_N(i, ABC) {
+      const float inv_s = 1.0f / dl_end[i],
+                  d2 = (dl_a - sq(dl_slope[i])) * inv_s,
+                  d4 = (12 * sq(dl_slope[i]) * inv_s - 3 * d2) * d2 * inv_s;
+      NOLESS(d4_max, ABS(d4));
+    }
+
+    uint16_t n = dl_segments - dl_k;
+    NOMORE(n, DELTA_SPAN_MAX);
+    if (d4_max > 0) {
+      const float n4 = (384 / 2) * (DELTA_INTERPOLATION_ERROR) / d4_max;
+      if (n4 < sq(sq(float(n)))) n = MAX(1, int(SQRT(SQRT(n4))));
+    }
+
+    // Fit the cubics to the exact values at both ends
+    float p0[ABC], m0[ABC];
+    COPY(p0, dl_end);
+    COPY(m0, dl_slope);
+    dl_span_end = dl_k + n;
+    delta_line_exact(dl_span_end, dl_end, dl_slope);
+
+    const float inv_n = 1.0f / n;
+    LOOP_L_N(i, ABC) {
+      const float chord = (dl_end[i] - p0[i]) * inv_n,
+                  c2 = (3 * chord - 2 * m0[i] - dl_slope[i]) * inv_n,
+                  c3 = (m0[i] + dl_slope[i] - 2 * chord) * sq(inv_n);
+      dl_tower[i] = p0[i];
+      dl_d1[i] = m0[i] + c2 + c3;
+      dl_d2[i] = 2 * c2 + 6 * c3;
+      dl_d3[i] = 6 * c3;
+    }
+  }
+
+  void delta_line_init(const float (&start)[XYZE], const float (&target)[XYZE], const uint16_t segments) {
+    const float inv_segments = 1.0f / float(segments),
+                dx = (target[X_AXIS] - start[X_AXIS]) * inv_segments,
+                dy = (target[Y_AXIS] - start[Y_AXIS]) * inv_segments;
+
+    #if HAS_HOTEND_OFFSET
+      const float x0 = start[X_AXIS] - hotend_offset[X_AXIS][active_extruder],
+                  y0 = start[Y_AXIS] - hotend_offset[Y_AXIS][active_extruder];
+    #else
+      const float x0 = start[X_AXIS], y0 = start[Y_AXIS];
+    #endif
+
+    dl_a = -(sq(dx) + sq(dy));
+    LOOP_L_N(i, ABC) {
+      const float rx = x0 - delta_tower[i][X_AXIS],
+                  ry = y0 - delta_tower[i][Y_AXIS];
+      dl_b[i] = -2 * (rx * dx + ry * dy);
+      dl_c[i] = delta_diagonal_rod_2_tower[i] - sq(rx) - sq(ry);
+    }
+
+    dl_k = dl_span_end = 0;
+    dl_segments = segments;
+    delta_line_exact(0, dl_end, dl_slope);
+  }
+
+  void delta_line_next(float (&towers)[ABC]) {
+    if (dl_k == dl_span_end) delta_line_span();
+    if (++dl_k == dl_span_end)
+      COPY(dl_tower, dl_end);
+    else LOOP_L_N(i, ABC) {
+      dl_tower[i] += dl_d1[i];
+      dl_d1[i] += dl_d2[i];
+      dl_d2[i] += dl_d3[i];
+    }
+    COPY(towers, dl_tower);
+  }
+
+#endif // DELTA_INTERPOLATION
+
 /**
  * Calculate the highest Z position where the
  * effector has the full range of XY motion.
@@ -83,6 +83,21 @@ FORCE_INLINE void inverse_kinematics(const float (&raw)[XYZE]) {
   inverse_kinematics(raw_xyz);
 }
 
+#if ENABLED(DELTA_INTERPOLATION)
+
+  /**
+   * Delta Line Interpolation
+   *
+   * Prepare the tower offsets (carriage height minus effector Z)
+   * for a line from 'start' to 'target' cut into 'segments' equal
+   * segments. delta_line_next() gives the offsets at the end of each
+   * segment in turn.
+   */
+  void delta_line_init(const float (&start)[XYZE], const float (&target)[XYZE], const uint16_t segments);
+  void delta_line_next(float (&towers)[ABC]);
+
+#endif
+
 /**
  * Calculate the highest Z position where the
  * effector has the full range of XY motion.
@@ -632,11 +632,18 @@ void Endstops::update() {
   // Record endstop was hit
   #define _ENDSTOP_HIT(AXIS, MINMAX) SBI(hit_state, _ENDSTOP(AXIS, MINMAX))
 
+  // With parallel homing each axis stops alone until the last one ends the move
+  #if ENABLED(PARALLEL_HOMING)
+    #define _ENDSTOP_ENDS_MOVE(AXIS) stepper.parallel_homing_stop(_AXIS(AXIS))
+  #else
+    #define _ENDSTOP_ENDS_MOVE(AXIS) true
+  #endif
+
   // Call the endstop triggered routine for single endstops
   #define PROCESS_ENDSTOP(AXIS,MINMAX) do { \
     if (TEST_ENDSTOP(_ENDSTOP(AXIS, MINMAX))) { \
       _ENDSTOP_HIT(AXIS, MINMAX); \
-      planner.endstop_triggered(_AXIS(AXIS)); \
+      if (_ENDSTOP_ENDS_MOVE(AXIS)) planner.endstop_triggered(_AXIS(AXIS)); \
     } \
   }while(0)
 
@@ -0,0 +1,95 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * input_shaping.cpp - Impulses of the input shapers
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(INPUT_SHAPING)
+
+#include "input_shaping.h"
+
+/**
+ * Set the impulses for a shaper tuned to 'frequency' (Hz) and 'damping'
+ * (the damping ratio). A frequency of 0 turns shaping off.
+ *
+ *  ZV  - Two impulses over half a period. Shortest, least tolerant of
+ *        a wrong frequency.
+ *  ZVD - Three impulses over a whole period. Much more tolerant.
+ *  MZV - Three impulses over 3/4 of a period. Nearly as tolerant as ZVD
+ *        and quicker.
+ */
+void ShapedAxis::set(const ShaperType type, const float &frequency, const float &damping) {
+  reset();
+
+  if (frequency <= 0) {
+    impulses = 1;
+    amplitude[0] = SHAPING_UNIT;
+    delay[0] = 0;
+    return;
+  }
+
+  const float root = SQRT(1 - sq(damping)),
+              period = 1 / (frequency * root);  // Damped period (s)
+
+  float a[SHAPER_MAX_IMPULSES], t[SHAPER_MAX_IMPULSES];
+  switch (type) {
+    default:
+    case SHAPER_ZV: {
+      const float K = expf(-damping * M_PI / root);
+      impulses = 2;
+      a[0] = 1; a[1] = K;
+      t[0] = 0; t[1] = 0.5f * period;
+    } break;
+
+    case SHAPER_ZVD: {
+      const float K = expf(-damping * M_PI / root);
+      impulses = 3;
+      a[0] = 1; a[1] = 2 * K; a[2] = sq(K);
+      t[0] = 0; t[1] = 0.5f * period; t[2] = period;
+    } break;
+
+    case SHAPER_MZV: {
+      const float K = expf(-0.75f * damping * M_PI / root),
+                  a1 = 1 - M_SQRT1_2;
+      impulses = 3;
+      a[0] = a1; a[1] = (M_SQRT2 - 1) * K; a[2] = a1 * sq(K);
+      t[0] = 0; t[1] = 0.375f * period; t[2] = 0.75f * period;
+    } break;
+  }
+
+  // Amplitudes in whole parts adding up to exactly one step
+  float sum = 0;
+  LOOP_L_N(i, impulses) sum += a[i];
+  uint8_t rest = SHAPING_UNIT;
+  for (uint8_t i = impulses; --i;) {
+    amplitude[i] = LROUND(a[i] * (SHAPING_UNIT) / sum);
+    rest -= amplitude[i];
+    delay[i] = t[i] * (STEPPER_TIMER_RATE);
+  }
+  amplitude[0] = rest;
+  delay[0] = 0;
+}
+
+#endif // INPUT_SHAPING
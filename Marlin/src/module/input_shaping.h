@@ -0,0 +1,136 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * input_shaping.h - Shape X and Y motion on the stepper timeline
+ *
+ * Each step event of a shaped axis is split into a few impulses that add
+ * up to one step: the first is applied at once and the others, its echoes,
+ * after fixed delays. The motor steps whenever the shaped position gets
+ * half a step away from it. The delays and amplitudes are chosen so the
+ * echoes cancel the ringing of the axis at its resonant frequency.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+enum ShaperType : uint8_t { SHAPER_ZV, SHAPER_ZVD, SHAPER_MZV };
+
+#define SHAPER_MAX_IMPULSES 3
+#define SHAPING_UNIT        128               // A whole step, in parts used for amplitudes
+#define SHAPING_NEVER       0xFFFFFFFF
+
+class ShapedAxis {
+public:
+  uint8_t impulses,                           // Impulses per event. 1 when shaping is off.
+          amplitude[SHAPER_MAX_IMPULSES];     // Parts of SHAPING_UNIT
+  uint32_t delay[SHAPER_MAX_IMPULSES];        // Stepper timer ticks after the event
+  int16_t error;                              // Shaped minus motor position, in parts of SHAPING_UNIT
+  int32_t pending;                            // Amplitude of the queued echoes, in parts of SHAPING_UNIT
+
+  void set(const ShaperType type, const float &frequency, const float &damping);
+
+  void reset() {
+    error = 0;
+    pending = 0;
+    head = 0;
+    LOOP_L_N(i, SHAPER_MAX_IMPULSES) echo[i] = 0;
+  }
+
+  // No echoes waiting
+  FORCE_INLINE bool idle() const { return impulses < 2 || echo[impulses - 1] == head; }
+
+  /**
+   * Apply the first impulse of a step event, queueing the others.
+   * Return true if echoes were queued.
+   */
+  FORCE_INLINE bool add_event(const uint32_t now, const bool forward) {
+    error += forward ? amplitude[0] : -amplitude[0];
+    if (impulses < 2) return false;
+
+    uint16_t next_head = head + 1;
+    if (next_head == SHAPING_BUFFER_SIZE) next_head = 0;
+
+    // If the queue is full, apply the echoes of the oldest event early
+    // rather than lose them. The motion stays right, if less smooth.
+    const uint8_t last = impulses - 1;
+    const uint16_t oldest = echo[last];
+    if (next_head == oldest) {
+      const bool oldest_forward = TEST(events[oldest], 0);
+      for (uint8_t k = 1; k <= last; k++) if (echo[k] == oldest) {
+        const int16_t a = oldest_forward ? amplitude[k] : -amplitude[k];
+        error += a;
+        pending -= a;
+        if (++echo[k] == SHAPING_BUFFER_SIZE) echo[k] = 0;
+      }
+    }
+
+    pending += forward ? SHAPING_UNIT - amplitude[0] : amplitude[0] - SHAPING_UNIT;
+    events[head] = (now & ~1UL) | forward;
+    head = next_head;
+    return true;
+  }
+
+  /**
+   * Apply the echoes that are due by 'now'.
+   * Return the ticks until the next one, or SHAPING_NEVER.
+   */
+  FORCE_INLINE uint32_t apply_echoes(const uint32_t now) {
+    uint32_t next = SHAPING_NEVER;
+    for (uint8_t k = 1; k < impulses; k++) {
+      uint16_t i = echo[k];
+      while (i != head) {
+        const int32_t wait = int32_t((events[i] & ~1UL) + delay[k] - now);
+        if (wait > 0) { NOMORE(next, uint32_t(wait)); break; }
+        const int16_t a = TEST(events[i], 0) ? amplitude[k] : -amplitude[k];
+        error += a;
+        pending -= a;
+        if (++i == SHAPING_BUFFER_SIZE) i = 0;
+      }
+      echo[k] = i;
+    }
+    return next;
+  }
+
+  // Steps the motor has yet to make for the events so far. Exact, since
+  // the amplitudes of an event add up to one step.
+  FORCE_INLINE int32_t steps_behind() const { return (error + pending) / (SHAPING_UNIT); }
+
+  // The motor is half a step or more away from the shaped position.
+  // Exactly half a step back is left alone, or the motor would dither.
+  FORCE_INLINE bool step_pending() const { return error >= SHAPING_UNIT / 2 || error < -(SHAPING_UNIT / 2); }
+
+  /**
+   * Take a step off the error if the motor is half a step or more behind.
+   * Return the step to make: 1, -1 or 0.
+   */
+  FORCE_INLINE int8_t step_due() {
+    if (error >= SHAPING_UNIT / 2) { error -= SHAPING_UNIT; return 1; }
+    if (error < -(SHAPING_UNIT / 2)) { error += SHAPING_UNIT; return -1; }
+    return 0;
+  }
+
+private:
+  uint32_t events[SHAPING_BUFFER_SIZE];       // Event times, with the direction in bit 0 (1 = forward)
+  uint16_t head,                              // Where the next event goes
+           echo[SHAPER_MAX_IMPULSES];         // Next event for each echo. The last one is the tail.
+};
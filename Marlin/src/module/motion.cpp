@@ -59,6 +59,10 @@
   #include "../feature/fwretract.h"
 #endif
 
+#if ENABLED(PATH_BLENDING)
+  #include "../feature/path_blending.h"
+#endif
+
 #define XYZ_CONSTS(type, array, CONFIG) const PROGMEM type array##_P[XYZ] = { X_##CONFIG, Y_##CONFIG, Z_##CONFIG }
 
 XYZ_CONSTS(float, base_min_pos,   MIN_POS);
@@ -275,6 +279,10 @@ void buffer_line_to_destination(const float fr_mm_s) {
       if (DEBUGGING(LEVELING)) DEBUG_POS("prepare_uninterpolated_move_to_destination", destination);
     #endif
 
+    #if ENABLED(PATH_BLENDING)
+      path_blending.flush();
+    #endif
+
     #if UBL_SEGMENTED
       // ubl segmented line will do z-only moves in single segment
       ubl.prepare_segmented_line_to(destination, MMS_SCALED(fr_mm_s ? fr_mm_s : feedrate_mm_s));
@@ -294,13 +302,15 @@ void buffer_line_to_destination(const float fr_mm_s) {
 #endif // IS_KINEMATIC
 
 /**
- *  Plan a move to (X, Y, Z) and set the current_position
+ *  Plan a move to (X, Y, Z) and set the current_position.
+ *  Returns as soon as the moves are queued, so a caller can line up
+ *  travel ahead of a probe or endstop move without draining the planner.
  */
-void do_blocking_move_to(const float rx, const float ry, const float rz, const float &fr_mm_s/*=0.0*/) {
+void plan_move_to(const float rx, const float ry, const float rz, const float &fr_mm_s/*=0.0*/) {
   const float old_feedrate_mm_s = feedrate_mm_s;
 
   #if ENABLED(DEBUG_LEVELING_FEATURE)
-    if (DEBUGGING(LEVELING)) print_xyz(PSTR(">>> do_blocking_move_to"), NULL, rx, ry, rz);
+    if (DEBUGGING(LEVELING)) print_xyz(PSTR(">>> plan_move_to"), NULL, rx, ry, rz);
   #endif
 
   const float z_feedrate = fr_mm_s ? fr_mm_s : homing_feedrate(Z_AXIS);
@@ -407,9 +417,18 @@ void do_blocking_move_to(const float rx, const float ry, const float rz, const f
   feedrate_mm_s = old_feedrate_mm_s;
 
   #if ENABLED(DEBUG_LEVELING_FEATURE)
-    if (DEBUGGING(LEVELING)) SERIAL_ECHOLNPGM("<<< do_blocking_move_to");
+    if (DEBUGGING(LEVELING)) SERIAL_ECHOLNPGM("<<< plan_move_to");
   #endif
+}
+void plan_move_to_z(const float &rz, const float &fr_mm_s/*=0.0*/) {
+  plan_move_to(current_position[X_AXIS], current_position[Y_AXIS], rz, fr_mm_s);
+}
 
+/**
+ *  Plan a move to (X, Y, Z) and wait for it to finish
+ */
+void do_blocking_move_to(const float rx, const float ry, const float rz, const float &fr_mm_s/*=0.0*/) {
+  plan_move_to(rx, ry, rz, fr_mm_s);
   planner.synchronize();
 }
 void do_blocking_move_to_x(const float &rx, const float &fr_mm_s/*=0.0*/) {
@@ -676,6 +695,12 @@ void clean_up_after_endstop_or_probe_move() { bracket_probe_move(false); }
     float raw[XYZE];
     COPY(raw, current_position);
 
+    #if ENABLED(DELTA_INTERPOLATION)
+      // Interpolate the towers between exact points
+      float towers[ABC];
+      delta_line_init(current_position, rtarget, segments);
+    #endif
+
     // Calculate and execute the segments
     while (--segments) {
 
@@ -688,12 +713,18 @@ void clean_up_after_endstop_or_probe_move() { bracket_probe_move(false); }
 
       LOOP_XYZE(i) raw[i] += segment_distance[i];
 
-      if (!planner.buffer_line(raw, _feedrate_mm_s, active_extruder, cartesian_segment_mm
-        #if ENABLED(SCARA_FEEDRATE_SCALING)
-          , inv_duration
-        #endif
-      ))
-        break;
+      #if ENABLED(DELTA_INTERPOLATION)
+        delta_line_next(towers);
+        if (!planner.buffer_line_towers(raw, towers, _feedrate_mm_s, active_extruder, cartesian_segment_mm))
+          break;
+      #else
+        if (!planner.buffer_line(raw, _feedrate_mm_s, active_extruder, cartesian_segment_mm
+          #if ENABLED(SCARA_FEEDRATE_SCALING)
+            , inv_duration
+          #endif
+        ))
+          break;
+      #endif
     }
 
     // Ensure last segment arrives at target location.
@@ -944,6 +975,29 @@ void clean_up_after_endstop_or_probe_move() { bracket_probe_move(false); }
 
 #endif // DUAL_X_CARRIAGE
 
+/**
+ * Send the move from current_position to destination to the planner,
+ * split up as needed for kinematics and leveling.
+ *
+ * Returns true if current_position[] was set to destination[]
+ */
+inline bool plan_move_to_destination() {
+  return (
+    #if UBL_SEGMENTED
+      //ubl.prepare_segmented_line_to(destination, MMS_SCALED(feedrate_mm_s))   // This doesn't seem to work correctly on UBL.
+      #if IS_KINEMATIC                                                          // Use Kinematic / Cartesian cases as a workaround for now.
+        ubl.prepare_segmented_line_to(destination, MMS_SCALED(feedrate_mm_s))
+      #else
+        prepare_move_to_destination_cartesian()
+      #endif
+    #elif IS_KINEMATIC
+      prepare_kinematic_move_to(destination)
+    #else
+      prepare_move_to_destination_cartesian()
+    #endif
+  );
+}
+
 /**
  * Prepare a single move and get ready for the next one
  *
@@ -981,24 +1035,39 @@ void prepare_move_to_destination() {
     if (dual_x_carriage_unpark()) return;
   #endif
 
-  if (
-    #if UBL_SEGMENTED
-      //ubl.prepare_segmented_line_to(destination, MMS_SCALED(feedrate_mm_s))   // This doesn't seem to work correctly on UBL.
-      #if IS_KINEMATIC                                                          // Use Kinematic / Cartesian cases as a workaround for now.
-        ubl.prepare_segmented_line_to(destination, MMS_SCALED(feedrate_mm_s))
-      #else
-        prepare_move_to_destination_cartesian()
-      #endif
-    #elif IS_KINEMATIC
-      prepare_kinematic_move_to(destination)
-    #else
-      prepare_move_to_destination_cartesian()
-    #endif
-  ) return;
+  #if ENABLED(PATH_BLENDING)
+    if (path_blending.hold_move()) return;
+  #endif
+
+  if (plan_move_to_destination()) return;
 
   set_current_from_destination();
 }
 
+#if ENABLED(PATH_BLENDING)
+
+  /**
+   * Queue a move held back or made up by path blending. The
+   * current position, destination and feedrate are left as they were.
+   */
+  void prepare_held_move(const float (&from)[XYZE], const float (&to)[XYZE], const float &fr_mm_s) {
+    float saved_current_position[XYZE], saved_destination[XYZE];
+    COPY(saved_current_position, current_position);
+    COPY(saved_destination, destination);
+    const float saved_feedrate_mm_s = feedrate_mm_s;
+
+    COPY(current_position, from);
+    COPY(destination, to);
+    feedrate_mm_s = fr_mm_s;
+    plan_move_to_destination();
+
+    COPY(current_position, saved_current_position);
+    COPY(destination, saved_destination);
+    feedrate_mm_s = saved_feedrate_mm_s;
+  }
+
+#endif // PATH_BLENDING
+
 #if HAS_AXIS_UNHOMED_ERR
 
   bool axis_unhomed_error(const bool x/*=true*/, const bool y/*=true*/, const bool z/*=true*/) {
@@ -1624,6 +1693,73 @@ void homeaxis(const AxisEnum axis) {
   #endif
 } // homeaxis()
 
+#if ENABLED(PARALLEL_HOMING)
+
+  /**
+   * Move X and Y together, at up to their own feedrates. When moving
+   * towards the endstops each moving axis stops at its own switch, and
+   * the move ends when all of them have stopped.
+   */
+  static void parallel_homing_move(const bool is_home_dir, const float &dx, const float &dy, const float &fr_x, const float &fr_y) {
+    float target[ABCE] = { 0, 0, planner.get_axis_position_mm(C_AXIS), planner.get_axis_position_mm(E_AXIS) };
+    planner.set_machine_position_mm(target);
+    target[X_AXIS] = dx;
+    target[Y_AXIS] = dy;
+
+    // Take as long as the slower axis needs
+    const float seconds = MAX(ABS(dx) / fr_x, ABS(dy) / fr_y);
+
+    if (is_home_dir) stepper.set_parallel_homing((dx ? _BV(X_AXIS) : 0) | (dy ? _BV(Y_AXIS) : 0));
+
+    planner.buffer_segment(target, HYPOT(dx, dy) / seconds, active_extruder);
+    planner.synchronize();
+
+    if (is_home_dir) {
+      #if ENABLED(VALIDATE_HOMING_ENDSTOPS)
+        if (!stepper.parallel_homing_done()) kill(PSTR(MSG_ERR_HOMING_FAILED));
+      #endif
+      stepper.set_parallel_homing(0);
+      endstops.hit_on_purpose();
+    }
+  }
+
+  /**
+   * Home X and Y at the same time: a fast approach, a move away and a
+   * slow bump, like homeaxis() does for one axis.
+   */
+  void home_xy_parallel() {
+    #if ENABLED(DEBUG_LEVELING_FEATURE)
+      if (DEBUGGING(LEVELING)) SERIAL_ECHOLNPGM(">>> home_xy_parallel");
+    #endif
+
+    parallel_homing_move(true,
+      1.5f * max_length(X_AXIS) * home_dir(X_AXIS),
+      1.5f * max_length(Y_AXIS) * home_dir(Y_AXIS),
+      homing_feedrate(X_AXIS), homing_feedrate(Y_AXIS)
+    );
+
+    const float bump_x = home_bump_mm(X_AXIS) * home_dir(X_AXIS),
+                bump_y = home_bump_mm(Y_AXIS) * home_dir(Y_AXIS);
+
+    if (bump_x || bump_y) {
+      parallel_homing_move(false, -bump_x, -bump_y, homing_feedrate(X_AXIS), homing_feedrate(Y_AXIS));
+      parallel_homing_move(true, 2 * bump_x, 2 * bump_y, get_homing_bump_feedrate(X_AXIS), get_homing_bump_feedrate(Y_AXIS));
+    }
+
+    set_axis_is_at_home(X_AXIS);
+    set_axis_is_at_home(Y_AXIS);
+    sync_plan_position();
+
+    destination[X_AXIS] = current_position[X_AXIS];
+    destination[Y_AXIS] = current_position[Y_AXIS];
+
+    #if ENABLED(DEBUG_LEVELING_FEATURE)
+      if (DEBUGGING(LEVELING)) DEBUG_POS("<<< home_xy_parallel", current_position);
+    #endif
+  }
+
+#endif // PARALLEL_HOMING
+
 #if HAS_WORKSPACE_OFFSET
   void update_workspace_offset(const AxisEnum axis) {
     workspace_offset[axis] = home_offset[axis] + position_shift[axis];
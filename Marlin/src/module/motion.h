@@ -162,6 +162,17 @@ void buffer_line_to_destination(const float fr_mm_s);
 
 void prepare_move_to_destination();
 
+#if ENABLED(PATH_BLENDING)
+  void prepare_held_move(const float (&from)[XYZE], const float (&to)[XYZE], const float &fr_mm_s);
+#endif
+
+/**
+ * Queue a move without waiting for it. A later blocking move
+ * (or planner.synchronize) is the point where the caller waits.
+ */
+void plan_move_to(const float rx, const float ry, const float rz, const float &fr_mm_s=0);
+void plan_move_to_z(const float &rz, const float &fr_mm_s=0);
+
 /**
  * Blocking movement and shorthand functions
  */
@@ -216,6 +227,10 @@ void set_axis_is_not_at_home(const AxisEnum axis);
 
 void homeaxis(const AxisEnum axis);
 
+#if ENABLED(PARALLEL_HOMING)
+  void home_xy_parallel();
+#endif
+
 /**
  * Workspace offsets
  */
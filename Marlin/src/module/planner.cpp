@@ -110,6 +110,21 @@ volatile uint8_t Planner::block_buffer_head,    // Index of the next block to be
                  Planner::block_buffer_tail;    // Index of the busy block, if any
 uint16_t Planner::cleaning_buffer_counter;      // A counter to disable queuing of blocks
 uint8_t Planner::delay_before_delivering;       // This counter delays delivery of blocks when queue becomes empty to allow the opportunity of merging blocks
+#if ENABLED(NATIVE_ARC_BLOCKS)
+  arc_plan_t Planner::arc_plan;                 // The arc being queued by buffer_arc()
+  bool Planner::arc_pending;                    // Set while buffer_arc() queues arc_plan
+#endif
+
+#if ENABLED(ARC_CHORD_SEGMENTS)
+  float Planner::arc_radius;                    // (mm) Radius of the arc being queued, 0 if none
+#endif
+
+#if ENABLED(POWER_LOSS_EXACT_RESUME)
+  uint32_t Planner::sdpos;                      // SD file offset of the command being planned, copied to new blocks
+#endif
+
+uint8_t Planner::batch_depth,                   // Nesting depth of begin_batch() / end_batch()
+        Planner::batch_pending;                 // Blocks queued in a batch that still need recalculate()
 
 planner_settings_t Planner::settings;           // Initialized by settings.load()
 
@@ -233,6 +248,7 @@ void Planner::init() {
   #endif
   clear_block_buffer();
   delay_before_delivering = 0;
+  batch_depth = batch_pending = 0;
 }
 
 #if ENABLED(S_CURVE_ACCELERATION)
@@ -717,35 +733,74 @@ void Planner::calculate_trapezoid_for_block(block_t* const block, const float &e
 
   const int32_t accel = block->acceleration_steps_per_s2;
 
+  #ifdef S_CURVE_JERK_LIMIT
+
+    // Jerk in steps/s^3 along this block
+    const float jerk = (S_CURVE_JERK_LIMIT) * accel / block->acceleration;
+
           // Steps required for acceleration, deceleration to/from nominal rate
-  uint32_t accelerate_steps = CEIL(estimate_acceleration_distance(initial_rate, block->nominal_rate, accel)),
-           decelerate_steps = FLOOR(estimate_acceleration_distance(block->nominal_rate, final_rate, -accel));
+    uint32_t accelerate_steps = CEIL(speed_change_distance(initial_rate, block->nominal_rate, accel, jerk)),
+             decelerate_steps = FLOOR(speed_change_distance(final_rate, block->nominal_rate, accel, jerk));
           // Steps between acceleration and deceleration, if any
-  int32_t plateau_steps = block->step_event_count - accelerate_steps - decelerate_steps;
+    int32_t plateau_steps = block->step_event_count - accelerate_steps - decelerate_steps;
+
+    // If the nominal rate can't be reached, find the highest rate that
+    // still leaves room to change to the final rate within the block.
+    // The planner made sure the lower of the two rates will do.
+    if (plateau_steps < 0) {
+      float low_rate = MAX(initial_rate, final_rate), high_rate = block->nominal_rate;
+      for (uint8_t i = 8; i--;) {
+        const float rate = 0.5f * (low_rate + high_rate);
+        if (speed_change_distance(initial_rate, rate, accel, jerk) + speed_change_distance(final_rate, rate, accel, jerk) > block->step_event_count)
+          high_rate = rate;
+        else
+          low_rate = rate;
+      }
+      cruise_rate = low_rate;
+      accelerate_steps = MIN(uint32_t(CEIL(speed_change_distance(initial_rate, cruise_rate, accel, jerk))), block->step_event_count);
+      plateau_steps = 0;
+    }
+    else
+      cruise_rate = block->nominal_rate;
 
-  // Does accelerate_steps + decelerate_steps exceed step_event_count?
-  // Then we can't possibly reach the nominal rate, there will be no cruising.
-  // Use intersection_distance() to calculate accel / braking time in order to
-  // reach the final_rate exactly at the end of this block.
-  if (plateau_steps < 0) {
-    const float accelerate_steps_float = CEIL(intersection_distance(initial_rate, final_rate, accel, block->step_event_count));
-    accelerate_steps = MIN(uint32_t(MAX(accelerate_steps_float, 0)), block->step_event_count);
-    plateau_steps = 0;
+  #else
 
+          // Steps required for acceleration, deceleration to/from nominal rate
+    uint32_t accelerate_steps = CEIL(estimate_acceleration_distance(initial_rate, block->nominal_rate, accel)),
+             decelerate_steps = FLOOR(estimate_acceleration_distance(block->nominal_rate, final_rate, -accel));
+          // Steps between acceleration and deceleration, if any
+    int32_t plateau_steps = block->step_event_count - accelerate_steps - decelerate_steps;
+
+    // Does accelerate_steps + decelerate_steps exceed step_event_count?
+    // Then we can't possibly reach the nominal rate, there will be no cruising.
+    // Use intersection_distance() to calculate accel / braking time in order to
+    // reach the final_rate exactly at the end of this block.
+    if (plateau_steps < 0) {
+      const float accelerate_steps_float = CEIL(intersection_distance(initial_rate, final_rate, accel, block->step_event_count));
+      accelerate_steps = MIN(uint32_t(MAX(accelerate_steps_float, 0)), block->step_event_count);
+      plateau_steps = 0;
+
+      #if ENABLED(S_CURVE_ACCELERATION)
+        // We won't reach the cruising rate. Let's calculate the speed we will reach
+        cruise_rate = final_speed(initial_rate, accel, accelerate_steps);
+      #endif
+    }
     #if ENABLED(S_CURVE_ACCELERATION)
-      // We won't reach the cruising rate. Let's calculate the speed we will reach
-      cruise_rate = final_speed(initial_rate, accel, accelerate_steps);
+      else // We have some plateau time, so the cruise rate will be the nominal rate
+        cruise_rate = block->nominal_rate;
     #endif
-  }
-  #if ENABLED(S_CURVE_ACCELERATION)
-    else // We have some plateau time, so the cruise rate will be the nominal rate
-      cruise_rate = block->nominal_rate;
-  #endif
+
+  #endif // !S_CURVE_JERK_LIMIT
 
   #if ENABLED(S_CURVE_ACCELERATION)
     // Jerk controlled speed requires to express speed versus time, NOT steps
-    uint32_t acceleration_time = ((float)(cruise_rate - initial_rate) / accel) * (STEPPER_TIMER_RATE),
-             deceleration_time = ((float)(cruise_rate - final_rate) / accel) * (STEPPER_TIMER_RATE);
+    #ifdef S_CURVE_JERK_LIMIT
+      uint32_t acceleration_time = speed_change_time(cruise_rate - initial_rate, accel, jerk) * (STEPPER_TIMER_RATE),
+               deceleration_time = speed_change_time(cruise_rate - final_rate, accel, jerk) * (STEPPER_TIMER_RATE);
+    #else
+      uint32_t acceleration_time = ((float)(cruise_rate - initial_rate) / accel) * (STEPPER_TIMER_RATE),
+               deceleration_time = ((float)(cruise_rate - final_rate) / accel) * (STEPPER_TIMER_RATE);
+    #endif
 
     // And to offload calculations from the ISR, we also calculate the inverse of those times here
     uint32_t acceleration_time_inverse = get_period_inverse(acceleration_time);
@@ -766,6 +821,35 @@ void Planner::calculate_trapezoid_for_block(block_t* const block, const float &e
   block->final_rate = final_rate;
 }
 
+#ifdef S_CURVE_JERK_LIMIT
+
+  /**
+   * The S-curve changes speed by dv over a time T along a 5th order
+   * polynomial, reaching a peak jerk of S_CURVE_JERK_FACTOR * dv / T^2.
+   * Keeping that within the jerk limit J takes T >= sqrt(S_CURVE_JERK_FACTOR * dv / J),
+   * which is longer than dv / a for small changes of speed. Either way the
+   * distance covered is the mean of the two speeds times T.
+   *
+   * Calculate the maximum speed squared at one end of 'distance' mm from
+   * which 'target_velocity_sqr' can be reached at the other end.
+   */
+  float Planner::max_jerk_limited_speed_sqr(const float &accel, const float &target_velocity_sqr, const float &distance) {
+    // Limited by acceleration, if the change is large enough
+    const float v_sqr = target_velocity_sqr + 2 * accel * distance,
+                target_velocity = SQRT(target_velocity_sqr);
+    if (SQRT(v_sqr) - target_velocity >= (S_CURVE_JERK_FACTOR) * sq(accel) / (S_CURVE_JERK_LIMIT)) return v_sqr;
+
+    // Limited by jerk. With dv = s^2, (2 * target_velocity + s^2) * s = 2 * distance * sqrt(J / S_CURVE_JERK_FACTOR).
+    // The one real root of this cubic, by Cardano's formula as a quotient to avoid cancellation.
+    const float q = distance * SQRT((S_CURVE_JERK_LIMIT) / (S_CURVE_JERK_FACTOR)),
+                p3 = target_velocity * (2.0f / 3.0f),
+                r = SQRT(sq(q) + sq(p3) * p3),
+                s = 2 * q / (sq(CBRT(q + r)) + p3 + sq(CBRT(r - q)));
+    return sq(target_velocity + sq(s));
+  }
+
+#endif // S_CURVE_JERK_LIMIT
+
 /*                            PLANNER SPEED DEFINITION
                                      +--------+   <- current->nominal_speed
                                     /          \
@@ -851,7 +935,7 @@ void Planner::reverse_pass_kernel(block_t* const current, const block_t * const
 
       const float new_entry_speed_sqr = TEST(current->flag, BLOCK_BIT_NOMINAL_LENGTH)
         ? max_entry_speed_sqr
-        : MIN(max_entry_speed_sqr, max_allowable_speed_sqr(-current->acceleration, next ? next->entry_speed_sqr : sq(float(MINIMUM_PLANNER_SPEED)), current->millimeters));
+        : MIN(max_entry_speed_sqr, max_allowable_speed_sqr(current, next ? next->entry_speed_sqr : sq(float(MINIMUM_PLANNER_SPEED))));
       if (current->entry_speed_sqr != new_entry_speed_sqr) {
 
         // Need to recalculate the block speed - Mark it now, so the stepper
@@ -936,7 +1020,7 @@ void Planner::forward_pass_kernel(const block_t* const previous, block_t* const
       previous->entry_speed_sqr < current->entry_speed_sqr) {
 
       // Compute the maximum allowable speed
-      const float new_entry_speed_sqr = max_allowable_speed_sqr(-previous->acceleration, previous->entry_speed_sqr, previous->millimeters);
+      const float new_entry_speed_sqr = max_allowable_speed_sqr(previous, previous->entry_speed_sqr);
 
       // If true, current block is full-acceleration and we can move the planned pointer forward.
       if (new_entry_speed_sqr < current->entry_speed_sqr) {
@@ -1135,6 +1219,17 @@ void Planner::recalculate() {
   recalculate_trapezoids();
 }
 
+/**
+ * Close a batch opened with begin_batch(). At the outermost level
+ * plan any blocks that were queued without a recalculate().
+ */
+void Planner::end_batch() {
+  if (batch_depth && !--batch_depth && batch_pending) {
+    batch_pending = 0;
+    recalculate();
+  }
+}
+
 #if ENABLED(AUTOTEMP)
 
   void Planner::getHighESpeed() {
@@ -1473,6 +1568,9 @@ void Planner::quick_stop() {
   // forced to empty, there's no risk the ISR will touch this.
   delay_before_delivering = BLOCK_DELAY_FOR_1ST_MOVE;
 
+  // Nothing is left for an open batch to plan
+  batch_pending = 0;
+
   #if ENABLED(ULTRA_LCD)
     // Clear the accumulated runtime
     clear_block_buffer_runtime();
@@ -1542,6 +1640,9 @@ void Planner::synchronize() {
     #if ENABLED(EXTERNAL_CLOSED_LOOP_CONTROLLER)
       || !READ(CLOSED_LOOP_MOVE_COMPLETE_PIN)
     #endif
+    #if ENABLED(INPUT_SHAPING)
+      || stepper.shaping_busy()
+    #endif
   ) idle();
 }
 
@@ -1669,10 +1770,20 @@ bool Planner::_buffer_steps(const int32_t (&target)[XYZE]
   // If we are cleaning, do not accept queuing of movements
   if (cleaning_buffer_counter) return false;
 
+  // A move queued from idle() while waiting must not be taken for the arc
+  #if ENABLED(NATIVE_ARC_BLOCKS)
+    const bool is_arc = arc_pending;
+    arc_pending = false;
+  #endif
+
   // Wait for the next available block
   uint8_t next_buffer_head;
   block_t * const block = get_next_free_block(next_buffer_head);
 
+  #if ENABLED(NATIVE_ARC_BLOCKS)
+    arc_pending = is_arc;
+  #endif
+
   // Fill the block with the specified movement
   if (!_populate_block(block, false, target
     #if HAS_POSITION_FLOAT
@@ -1701,6 +1812,11 @@ bool Planner::_buffer_steps(const int32_t (&target)[XYZE]
   // Move buffer head
   block_buffer_head = next_buffer_head;
 
+  // In a batch, defer the recalculation while the stepper has enough planned blocks
+  if (batch_depth && ++batch_pending < PLANNER_BATCH_MAX && movesplanned() > batch_pending + 2)
+    return true;
+  batch_pending = 0;
+
   // Recalculate and optimize trapezoidal speed profiles
   recalculate();
 
@@ -1730,6 +1846,12 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   , float fr_mm_s, const uint8_t extruder, const float &millimeters/*=0.0*/
 ) {
 
+  #if ENABLED(NATIVE_ARC_BLOCKS)
+    // Only the block queued by buffer_arc() is an arc
+    const bool is_arc = arc_pending;
+    arc_pending = false;
+  #endif
+
   const int32_t da = target[A_AXIS] - position[A_AXIS],
                 db = target[B_AXIS] - position[B_AXIS],
                 dc = target[C_AXIS] - position[C_AXIS];
@@ -1807,6 +1929,13 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   // Clear all flags, including the "busy" bit
   block->flag = 0x00;
 
+  #if ENABLED(POWER_LOSS_EXACT_RESUME)
+    block->sdpos = sdpos;
+    block->feedrate = uint16_t(feedrate_mm_s * 60.0f);
+    block->e_start = position[E_AXIS] * steps_to_mm[E_AXIS_N(extruder)];
+    block->e_end = target[E_AXIS] * steps_to_mm[E_AXIS_N(extruder)];
+  #endif
+
   // Set direction bits
   block->direction_bits = dm;
 
@@ -1911,6 +2040,16 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   block->steps[E_AXIS] = esteps;
   block->step_event_count = MAX(block->steps[A_AXIS], block->steps[B_AXIS], block->steps[C_AXIS], esteps);
 
+  #if ENABLED(NATIVE_ARC_BLOCKS)
+    if (is_arc) {
+      // X and Y follow the chords of the arc, and either may move its whole length
+      NOLESS(block->step_event_count, arc_plan.events);
+      block->steps[X_AXIS] = block->steps[Y_AXIS] = arc_plan.events;
+      block->arc = arc_plan.arc;
+      block->flag |= BLOCK_FLAG_ARC;
+    }
+  #endif
+
   // Bail if this is a zero-length block
   if (block->step_event_count < MIN_STEPS_PER_SEGMENT) return false;
 
@@ -2191,6 +2330,16 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     if (cs > settings.max_feedrate_mm_s[i]) NOMORE(speed_factor, settings.max_feedrate_mm_s[i] / cs);
   }
 
+  #if ENABLED(NATIVE_ARC_BLOCKS)
+    if (is_arc) {
+      // Somewhere on the arc X and Y each reach the full XY speed
+      const float xy_speed = arc_plan.xy_mm * inverse_secs;
+      for (uint8_t i = X_AXIS; i <= Y_AXIS; i++) if (xy_speed > settings.max_feedrate_mm_s[i]) NOMORE(speed_factor, settings.max_feedrate_mm_s[i] / xy_speed);
+      // The entry speed of each axis follows the tangent at the start
+      for (uint8_t i = X_AXIS; i <= Y_AXIS; i++) current_speed[i] = arc_plan.tangent_in[i] * xy_speed;
+    }
+  #endif
+
   // Max segment time in µs.
   #ifdef XY_FREQUENCY_LIMIT
 
@@ -2417,6 +2566,11 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
       normalize_junction_vector(unit_vec);
     #endif
 
+    #if ENABLED(NATIVE_ARC_BLOCKS)
+      // An arc meets the previous block along its starting tangent
+      if (is_arc) for (uint8_t i = X_AXIS; i <= Y_AXIS; i++) unit_vec[i] = arc_plan.tangent_in[i] * arc_plan.xy_mm * inverse_millimeters;
+    #endif
+
     // Skip first block or when previous_nominal_speed is used as a flag for homing and offset cycles.
     if (moves_queued && !UNEAR_ZERO(previous_nominal_speed_sqr)) {
       // Compute cosine of angle between previous and current path. (prev_unit_vec is negative)
@@ -2435,16 +2589,15 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
       else {
         NOLESS(junction_cos_theta, -0.999999f); // Check for numerical round-off to avoid divide by zero.
 
-        // Convert delta vector to unit vector
-        float junction_unit_vec[XYZE] = {
+        // Direction of the junction. Left unnormalized, as the axis limit only needs its direction.
+        const float junction_vec[XYZE] = {
           unit_vec[X_AXIS] - previous_unit_vec[X_AXIS],
           unit_vec[Y_AXIS] - previous_unit_vec[Y_AXIS],
           unit_vec[Z_AXIS] - previous_unit_vec[Z_AXIS],
           unit_vec[E_AXIS] - previous_unit_vec[E_AXIS]
         };
-        normalize_junction_vector(junction_unit_vec);
 
-        const float junction_acceleration = limit_value_by_axis_maximum(block->acceleration, junction_unit_vec),
+        const float junction_acceleration = limit_value_by_axis_maximum(block->acceleration, junction_vec),
                     sin_theta_d2 = SQRT(0.5f * (1.0f - junction_cos_theta)); // Trig half angle identity. Always positive.
 
         vmax_junction_sqr = (junction_acceleration * junction_deviation_mm * sin_theta_d2) / (1.0f - sin_theta_d2);
@@ -2469,6 +2622,11 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
 
     COPY(previous_unit_vec, unit_vec);
 
+    #if ENABLED(NATIVE_ARC_BLOCKS)
+      // ...and leaves along its ending tangent
+      if (is_arc) for (uint8_t i = X_AXIS; i <= Y_AXIS; i++) previous_unit_vec[i] = arc_plan.tangent_out[i] * arc_plan.xy_mm * inverse_millimeters;
+    #endif
+
   #endif
 
   #if HAS_CLASSIC_JERK
@@ -2569,11 +2727,18 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
 
   #endif // Classic Jerk Limiting
 
+  #if ENABLED(ARC_CHORD_SEGMENTS)
+    // A junction inside an arc follows the arc itself, so its speed
+    // is also limited by the centripetal acceleration v^2 / r.
+    if (arc_radius && moves_queued)
+      NOMORE(vmax_junction_sqr, block->acceleration * arc_radius);
+  #endif
+
   // Max entry speed of this block equals the max exit speed of the previous block.
   block->max_entry_speed_sqr = vmax_junction_sqr;
 
   // Initialize block entry speed. Compute based on deceleration to user-defined MINIMUM_PLANNER_SPEED.
-  const float v_allowable_sqr = max_allowable_speed_sqr(-block->acceleration, sq(float(MINIMUM_PLANNER_SPEED)), block->millimeters);
+  const float v_allowable_sqr = max_allowable_speed_sqr(block, sq(float(MINIMUM_PLANNER_SPEED)));
 
   // If we are trying to add a split block, start with the
   // max. allowed speed to avoid an interrupted first move.
@@ -2593,6 +2758,14 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   COPY(previous_speed, current_speed);
   previous_nominal_speed_sqr = block->nominal_speed_sqr;
 
+  #if ENABLED(NATIVE_ARC_BLOCKS)
+    if (is_arc) {
+      // The next block joins the arc on its ending tangent
+      const float xy_speed = SQRT(block->nominal_speed_sqr) * arc_plan.xy_mm * inverse_millimeters;
+      for (uint8_t i = X_AXIS; i <= Y_AXIS; i++) previous_speed[i] = arc_plan.tangent_out[i] * xy_speed;
+    }
+  #endif
+
   // Update the position
   static_assert(COUNT(target) > 1, "Parameter to _buffer_steps must be (&target)[XYZE]!");
   COPY(position, target);
@@ -2618,6 +2791,11 @@ void Planner::buffer_sync_block() {
 
   block->flag = BLOCK_FLAG_SYNC_POSITION;
 
+  #if ENABLED(POWER_LOSS_EXACT_RESUME)
+    block->sdpos = sdpos;
+    block->feedrate = uint16_t(feedrate_mm_s * 60.0f);
+  #endif
+
   block->position[A_AXIS] = position[A_AXIS];
   block->position[B_AXIS] = position[B_AXIS];
   block->position[C_AXIS] = position[C_AXIS];
@@ -2734,6 +2912,81 @@ bool Planner::buffer_segment(const float &a, const float &b, const float &c, con
   return true;
 } // buffer_segment()
 
+#if ENABLED(NATIVE_ARC_BLOCKS)
+
+  /**
+   * Add an XY arc to the buffer as a single block. The chords are sized to
+   * stay within half a step of the circle, then walked once here to count
+   * their step events. The stepper walks the same chords to run the block.
+   *
+   * Returns false if the arc can't be one block, so the caller must segment it.
+   */
+  bool Planner::buffer_arc(const float (&cart)[XYZE], const float (&center)[2], const float &angular_travel,
+                           const float &fr_mm_s, const uint8_t extruder, const float &millimeters
+  ) {
+    arc_plan_t &plan = arc_plan;
+    arc_block_t &arc = plan.arc;
+
+    for (uint8_t i = X_AXIS; i <= Y_AXIS; i++) {
+      arc.steps_per_mm[i] = settings.axis_steps_per_mm[i];
+      arc.center[i] = center[i] * arc.steps_per_mm[i];
+      arc.radius[i] = position[i] * steps_to_mm[i] - center[i];
+      arc.start[i] = position[i];
+      arc.end[i] = LROUND(cart[i] * arc.steps_per_mm[i]);
+    }
+
+    // Chord angle for a sagitta of half a step: r * (1 - cos(a / 2)) = e
+    const float radius = HYPOT(arc.radius[X_AXIS], arc.radius[Y_AXIS]),
+                half_step = 0.5f / MAX(arc.steps_per_mm[X_AXIS], arc.steps_per_mm[Y_AXIS]);
+    if (radius < 4 * half_step) return false;
+    const float chords = CEIL(ABS(angular_travel) / (2 * acosf(1 - half_step / radius)));
+    if (chords > 65535) return false;
+    arc.chords = MAX(chords, 1);
+
+    const float chord_angle = angular_travel / arc.chords;
+    arc.rotation[0] = cos(chord_angle);
+    arc.rotation[1] = sin(chord_angle);
+
+    // Count the step events of all the chords. Events follow the length of
+    // each chord, so the nominal step rate gives a constant tool speed.
+    plan.events = 0;
+    ArcWalker walker;
+    walker.start(arc);
+    int32_t delta[2];
+    for (uint32_t events; walker.next(delta, events);) plan.events += events;
+
+    // Z and E only need the modifiers that shift them evenly
+    float rz = cart[Z_AXIS], re = cart[E_AXIS];
+    #if ENABLED(FWRETRACT)
+      apply_retract(rz, re);
+    #endif
+
+    // Z and E are traced over the whole block, so they must fit in the XY events
+    const uint32_t z_steps = ABS(LROUND(rz * settings.axis_steps_per_mm[Z_AXIS]) - position[Z_AXIS]),
+                   e_steps = ABS((LROUND(re * settings.axis_steps_per_mm[E_AXIS_N(extruder)]) - position[E_AXIS]) * e_factor[extruder]);
+    if (plan.events < MIN_STEPS_PER_SEGMENT || z_steps > plan.events || e_steps > plan.events) return false;
+
+    // Unit tangents at the start and end, in the direction of travel
+    const float dir = angular_travel < 0 ? -1 : 1,
+                end_r[2] = { cart[X_AXIS] - center[X_AXIS], cart[Y_AXIS] - center[Y_AXIS] },
+                inv_end_r = dir / HYPOT(end_r[X_AXIS], end_r[Y_AXIS]);
+    plan.tangent_in[X_AXIS] = -arc.radius[Y_AXIS] * dir / radius;
+    plan.tangent_in[Y_AXIS] =  arc.radius[X_AXIS] * dir / radius;
+    plan.tangent_out[X_AXIS] = -end_r[Y_AXIS] * inv_end_r;
+    plan.tangent_out[Y_AXIS] =  end_r[X_AXIS] * inv_end_r;
+    plan.xy_mm = ABS(angular_travel) * radius;
+
+    // Keep the centripetal acceleration within the printing acceleration
+    const float feedrate = MIN(fr_mm_s, SQRT(settings.acceleration * radius));
+
+    arc_pending = true;
+    const bool queued = buffer_segment(cart[X_AXIS], cart[Y_AXIS], rz, re, feedrate, extruder, millimeters);
+    arc_pending = false;
+    return queued;
+  }
+
+#endif // NATIVE_ARC_BLOCKS
+
 /**
  * Add a new linear movement to the buffer.
  * The target is cartesian, it's translated to delta/scara if
@@ -2799,6 +3052,37 @@ bool Planner::buffer_line(const float &rx, const float &ry, const float &rz, con
   #endif
 } // buffer_line()
 
+#if ENABLED(DELTA_INTERPOLATION)
+
+  bool Planner::buffer_line_towers(const float (&cart)[XYZE], const float (&towers)[ABC], const float &fr_mm_s, const uint8_t extruder, const float &millimeters) {
+    float raw[XYZE];
+    COPY(raw, cart);
+    #if HAS_POSITION_MODIFIERS
+      apply_modifiers(raw); // Leveling and retraction only move Z and E
+    #endif
+
+    #if ENABLED(JUNCTION_DEVIATION)
+      const float delta_mm_cart[] = {
+        cart[X_AXIS] - position_cart[X_AXIS],
+        cart[Y_AXIS] - position_cart[Y_AXIS],
+        cart[Z_AXIS] - position_cart[Z_AXIS],
+        cart[E_AXIS] - position_cart[E_AXIS]
+      };
+    #endif
+
+    if (!buffer_segment(raw[Z_AXIS] + towers[A_AXIS], raw[Z_AXIS] + towers[B_AXIS], raw[Z_AXIS] + towers[C_AXIS], raw[E_AXIS]
+      #if ENABLED(JUNCTION_DEVIATION)
+        , delta_mm_cart
+      #endif
+      , fr_mm_s, extruder, millimeters
+    )) return false;
+
+    COPY(position_cart, cart);
+    return true;
+  }
+
+#endif // DELTA_INTERPOLATION
+
 /**
  * Directly set the planner ABC position (and stepper positions)
  * converting mm (or angles for SCARA) into steps.
@@ -51,6 +51,10 @@
   #include "../feature/mixing.h"
 #endif
 
+#if ENABLED(NATIVE_ARC_BLOCKS)
+  #include "planner_arc.h"
+#endif
+
 enum BlockFlagBit : char {
   // Recalculate trapezoids on entry junction. For optimization.
   BLOCK_BIT_RECALCULATE,
@@ -64,14 +68,18 @@ enum BlockFlagBit : char {
   BLOCK_BIT_CONTINUED,
 
   // Sync the stepper counts from the block
-  BLOCK_BIT_SYNC_POSITION
+  BLOCK_BIT_SYNC_POSITION,
+
+  // The block is an XY arc (NATIVE_ARC_BLOCKS)
+  BLOCK_BIT_ARC
 };
 
 enum BlockFlag : char {
   BLOCK_FLAG_RECALCULATE          = _BV(BLOCK_BIT_RECALCULATE),
   BLOCK_FLAG_NOMINAL_LENGTH       = _BV(BLOCK_BIT_NOMINAL_LENGTH),
   BLOCK_FLAG_CONTINUED            = _BV(BLOCK_BIT_CONTINUED),
-  BLOCK_FLAG_SYNC_POSITION        = _BV(BLOCK_BIT_SYNC_POSITION)
+  BLOCK_FLAG_SYNC_POSITION        = _BV(BLOCK_BIT_SYNC_POSITION),
+  BLOCK_FLAG_ARC                  = _BV(BLOCK_BIT_ARC)
 };
 
 /**
@@ -155,13 +163,28 @@ typedef struct block_t {
     uint8_t valve_pressure, e_to_p_pressure;
   #endif
 
+  #if ENABLED(NATIVE_ARC_BLOCKS)
+    arc_block_t arc;                        // Chords for the stepper to walk, if BLOCK_BIT_ARC is set
+  #endif
+
   uint32_t segment_time_us;
 
+  #if ENABLED(POWER_LOSS_EXACT_RESUME)
+    uint32_t sdpos;                         // SD file offset of the G-code line that made this block
+    uint16_t feedrate;                      // Modal feedrate (mm/min) once that line was read
+    float e_start, e_end;                   // (mm) Planner E before and after the block, without flow factors
+  #endif
+
 } block_t;
 
 #define HAS_POSITION_FLOAT (ENABLED(LIN_ADVANCE) || ENABLED(SCARA_FEEDRATE_SCALING))
 
 #define BLOCK_MOD(n) ((n)&(BLOCK_BUFFER_SIZE-1))
+#define PLANNER_BATCH_MAX (BLOCK_BUFFER_SIZE / 2) // Most blocks a batch may queue between recalculations
+
+#ifdef S_CURVE_JERK_LIMIT
+  #define S_CURVE_JERK_FACTOR 5.7735027f // Peak jerk of the S-curve in units of dv / T^2 (10 / sqrt(3))
+#endif
 
 typedef struct {
   uint32_t max_acceleration_mm_per_s2[XYZE_N],  // (mm/s^2) M201 XYZE
@@ -218,6 +241,21 @@ class Planner {
                             block_buffer_tail;      // Index of the busy block, if any
     static uint16_t cleaning_buffer_counter;        // A counter to disable queuing of blocks
     static uint8_t delay_before_delivering;         // This counter delays delivery of blocks when queue becomes empty to allow the opportunity of merging blocks
+    #if ENABLED(ARC_CHORD_SEGMENTS)
+      static float arc_radius;                      // (mm) Radius of the arc being queued, 0 if none
+    #endif
+
+    #if ENABLED(NATIVE_ARC_BLOCKS)
+      static arc_plan_t arc_plan;                   // The arc being queued by buffer_arc()
+      static bool arc_pending;                      // Set while buffer_arc() queues arc_plan. Read only by _populate_block().
+    #endif
+
+    #if ENABLED(POWER_LOSS_EXACT_RESUME)
+      static uint32_t sdpos;                        // SD file offset of the command being planned, copied to new blocks
+    #endif
+
+    static uint8_t batch_depth,                     // Nesting depth of begin_batch() / end_batch()
+                   batch_pending;                   // Blocks queued in a batch that still need recalculate()
 
 
     #if ENABLED(DISTINCT_E_FACTORS)
@@ -684,6 +722,39 @@ class Planner {
       );
     }
 
+    #if ENABLED(DELTA_INTERPOLATION)
+      /**
+       * Add a new linear movement to the buffer, like buffer_line, with
+       * the tower offsets from the delta line interpolator in place of
+       * inverse kinematics.
+       *
+       *  cart         - target position in mm
+       *  towers       - carriage heights minus the effector Z
+       *  fr_mm_s      - (target) speed of the move (mm/s)
+       *  extruder     - target extruder
+       *  millimeters  - the length of the movement
+       */
+      static bool buffer_line_towers(const float (&cart)[XYZE], const float (&towers)[ABC], const float &fr_mm_s, const uint8_t extruder, const float &millimeters);
+    #endif
+
+    #if ENABLED(NATIVE_ARC_BLOCKS)
+      /**
+       * Add an XY arc to the buffer as a single block, from the
+       * current position to the target. Z and E move linearly.
+       *
+       *  cart           - target position in mm
+       *  center         - XY center of the arc in mm
+       *  angular_travel - angle of the arc in radians, positive for CCW
+       *  fr_mm_s        - (target) speed of the move (mm/s)
+       *  extruder       - target extruder
+       *  millimeters    - the length of the arc, including Z travel
+       *
+       * Returns false if the arc can't be one block, so the caller must segment it.
+       */
+      static bool buffer_arc(const float (&cart)[XYZE], const float (&center)[2], const float &angular_travel,
+                             const float &fr_mm_s, const uint8_t extruder, const float &millimeters);
+    #endif
+
     /**
      * Set the planner.position and individual stepper positions.
      * Used by G92, G28, G29, and other procedures.
@@ -748,6 +819,14 @@ class Planner {
       }
     }
 
+    /**
+     * Batched queuing of the many short segments produced for a single move.
+     * Inside a batch recalculate() runs only when the stepper is running short
+     * of planned blocks, and once more at end_batch(). Batches may nest.
+     */
+    FORCE_INLINE static void begin_batch() { batch_depth++; }
+    static void end_batch();
+
     /**
      * Does the buffer have any blocks queued?
      */
@@ -925,6 +1004,38 @@ class Planner {
       }
     #endif
 
+    #ifdef S_CURVE_JERK_LIMIT
+      /**
+       * Calculate the time for the S-curve to change speed by 'delta_v',
+       * at no more than 'accel' on average and within 'jerk' at all times.
+       */
+      FORCE_INLINE static float speed_change_time(const float &delta_v, const float &accel, const float &jerk) {
+        return MAX(delta_v / accel, SQRT((S_CURVE_JERK_FACTOR) * delta_v / jerk));
+      }
+
+      /**
+       * Calculate the distance covered changing speed between the
+       * lower 'low_rate' and the higher 'high_rate'
+       */
+      FORCE_INLINE static float speed_change_distance(const float &low_rate, const float &high_rate, const float &accel, const float &jerk) {
+        return 0.5f * (low_rate + high_rate) * speed_change_time(high_rate - low_rate, accel, jerk);
+      }
+
+      static float max_jerk_limited_speed_sqr(const float &accel, const float &target_velocity_sqr, const float &distance);
+    #endif
+
+    /**
+     * Calculate the maximum allowable speed squared at one end of a block,
+     * in order to reach 'target_velocity_sqr' at the other end.
+     */
+    FORCE_INLINE static float max_allowable_speed_sqr(const block_t * const block, const float &target_velocity_sqr) {
+      #ifdef S_CURVE_JERK_LIMIT
+        return max_jerk_limited_speed_sqr(block->acceleration, target_velocity_sqr, block->millimeters);
+      #else
+        return max_allowable_speed_sqr(-block->acceleration, target_velocity_sqr, block->millimeters);
+      #endif
+    }
+
     static void calculate_trapezoid_for_block(block_t* const block, const float &entry_factor, const float &exit_factor);
 
     static void reverse_pass_kernel(block_t* const current, const block_t * const next);
@@ -946,11 +1057,25 @@ class Planner {
         LOOP_XYZE(idx) vector[idx] *= inv_magnitude;
       }
 
-      FORCE_INLINE static float limit_value_by_axis_maximum(const float &max_value, float (&unit_vec)[XYZE]) {
-        float limit_value = max_value;
-        LOOP_XYZE(idx) if (unit_vec[idx]) // Avoid divide by zero
-          NOMORE(limit_value, ABS(settings.max_acceleration_mm_per_s2[idx] / unit_vec[idx]));
-        return limit_value;
+      /**
+       * Limit a value along a direction by the per-axis maximum accelerations.
+       * The vector doesn't need to be normalized: the limiting axis is found by
+       * cross-multiplying, so at most one division is done instead of one per axis.
+       */
+      FORCE_INLINE static float limit_value_by_axis_maximum(const float &max_value, const float (&vector)[XYZE]) {
+        float magnitude_sq = 0, limit_accel = 0, limit_comp = 0;
+        LOOP_XYZE(idx) if (vector[idx]) {
+          const float comp = ABS(vector[idx]), accel = settings.max_acceleration_mm_per_s2[idx];
+          magnitude_sq += sq(comp);
+          // Keep the axis with the lowest accel / comp
+          if (!limit_comp || accel * limit_comp < limit_accel * comp) {
+            limit_accel = accel;
+            limit_comp = comp;
+          }
+        }
+        if (!limit_comp) return max_value;
+        const float limit_num = limit_accel * SQRT(magnitude_sq);
+        return max_value * limit_comp < limit_num ? max_value : limit_num / limit_comp;
       }
 
     #endif // JUNCTION_DEVIATION
@@ -0,0 +1,79 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * planner_arc.cpp
+ *
+ * Chord walker shared by the planner and stepper for arc blocks
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(NATIVE_ARC_BLOCKS)
+
+#include "planner_arc.h"
+
+void ArcWalker::start(const arc_block_t &a) {
+  arc = &a;
+  radius[0] = a.radius[0];
+  radius[1] = a.radius[1];
+  position[0] = a.start[0];
+  position[1] = a.start[1];
+  length = 0;
+  events_done = 0;
+  chord = 0;
+}
+
+bool ArcWalker::next(int32_t (&delta)[2], uint32_t &events) {
+  if (chord >= arc->chords) return false;
+
+  int32_t target[2];
+  if (++chord == arc->chords) {
+    // The last chord ends exactly on the target
+    target[0] = arc->end[0];
+    target[1] = arc->end[1];
+  }
+  else {
+    // Rotate the radius vector by one chord
+    const float r0 = radius[0] * arc->rotation[0] - radius[1] * arc->rotation[1];
+    radius[1] = radius[0] * arc->rotation[1] + radius[1] * arc->rotation[0];
+    radius[0] = r0;
+    target[0] = LROUND(arc->center[0] + radius[0] * arc->steps_per_mm[0]);
+    target[1] = LROUND(arc->center[1] + radius[1] * arc->steps_per_mm[1]);
+  }
+
+  delta[0] = target[0] - position[0];
+  delta[1] = target[1] - position[1];
+  position[0] = target[0];
+  position[1] = target[1];
+
+  // One event per step of the finer axis along the chord. Rounding is
+  // carried over to the next chord so the speed doesn't drift.
+  const float scale = MAX(arc->steps_per_mm[0], arc->steps_per_mm[1]);
+  length += HYPOT(delta[0] / arc->steps_per_mm[0], delta[1] / arc->steps_per_mm[1]) * scale;
+  const int32_t due = LROUND(length) - int32_t(events_done);
+  events = MAX(due, ABS(delta[0]), ABS(delta[1]));
+  events_done += events;
+  return true;
+}
+
+#endif // NATIVE_ARC_BLOCKS
@@ -0,0 +1,77 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * planner_arc.h
+ *
+ * Arc blocks for NATIVE_ARC_BLOCKS. The planner queues a whole XY arc as
+ * one block and the stepper walks it as a chain of short chords, each
+ * traced with Bresenham. Chords are fine enough to stay within half a
+ * step of the true circle, so no linear segments reach the planner.
+ */
+
+#include <stdint.h>
+
+typedef struct {
+  float center[2],          // (steps) Arc center
+        radius[2],          // (mm) Vector from the center to the start
+        rotation[2],        // Cosine and sine of the angle per chord
+        steps_per_mm[2];    // Axis scaling at the time the arc was planned
+  int32_t start[2],         // (steps) XY position at the start of the block
+          end[2];           // (steps) XY position reached by the last chord
+  uint16_t chords;          // Number of chords in the arc
+} arc_block_t;
+
+// What the planner needs to know about an arc while queuing it
+typedef struct {
+  arc_block_t arc;
+  uint32_t events;          // Step events of all the chords together
+  float xy_mm,              // (mm) Length of the arc in the XY plane
+        tangent_in[2],      // Unit direction at the start of the arc
+        tangent_out[2];     // ...and at the end
+} arc_plan_t;
+
+/**
+ * Step through the chords of an arc block. The planner and the stepper
+ * both walk the same arc with this, so they agree on every chord.
+ */
+class ArcWalker {
+  public:
+    void start(const arc_block_t &arc);
+
+    /**
+     * Step distance to the end of the next chord, and the step events to
+     * spend on it. Events follow the length of the chord, not its longest
+     * axis, so every chord runs at the same tool speed. False when no
+     * chords remain.
+     */
+    bool next(int32_t (&delta)[2], uint32_t &events);
+
+  private:
+    const arc_block_t *arc;
+    float radius[2],
+          length;           // (events) Length of the chords so far
+    int32_t position[2];
+    uint32_t events_done;   // Events given to the chords so far
+    uint16_t chord;
+};
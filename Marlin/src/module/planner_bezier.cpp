@@ -39,89 +39,102 @@
 #include "../core/language.h"
 #include "../gcode/queue.h"
 
-// See the meaning in the documentation of cubic_b_spline().
-#define MIN_STEP 0.002f
-#define MAX_STEP 0.1f
-#define SIGMA 0.1f
+#ifndef BEZIER_TOLERANCE
+  #define BEZIER_TOLERANCE 0.05f
+#endif
+
+// Smallest parameter step, to bound the work on degenerate curves
+#define MIN_STEP 0.001f
+
+// Bisections to refine each step once it is bracketed
+#define STEP_BISECTIONS 4
+
+// Flatness limit, squared and scaled as for flatness()
+#define FLAT_LIMIT (16 * sq(BEZIER_TOLERANCE))
 
 // Compute the linear interpolation between two real numbers.
 static inline float interp(const float &a, const float &b, const float &t) { return (1 - t) * a + t * b; }
 
+// The control points of one axis of a cubic Bézier curve
+typedef struct { float p0, p1, p2, p3; } bezier_axis_t;
+
+// Value of the curve at t
+static inline float eval_bezier(const bezier_axis_t &b, const float &t) {
+  const float u = 1 - t;
+  return u * u * u * b.p0 + 3 * t * u * (u * b.p1 + t * b.p2) + t * t * t * b.p3;
+}
+
+// Derivative of the curve at t
+static inline float eval_bezier_d(const bezier_axis_t &b, const float &t) {
+  const float u = 1 - t;
+  return 3 * (u * u * (b.p1 - b.p0) + 2 * u * t * (b.p2 - b.p1) + t * t * (b.p3 - b.p2));
+}
+
+// A point on the curve with its derivative
+typedef struct { float x, y, dx, dy; } bezier_point_t;
+
 /**
- * Compute a Bézier curve using the De Casteljau's algorithm (see
- * https://en.wikipedia.org/wiki/De_Casteljau%27s_algorithm), which is
- * easy to code and has good numerical stability (very important,
- * since Arudino works with limited precision real numbers).
+ * Flatness of one axis of the piece of curve between two points, given the
+ * positions and the derivatives (times the step) at its ends. The control
+ * points of the piece are q0, q0 + d0/3, q3 - d3/3, q3, and the result is
+ * the largest squared distance term of the flatness bound for that axis.
  */
-static inline float eval_bezier(const float &a, const float &b, const float &c, const float &d, const float &t) {
-  const float iab = interp(a, b, t),
-              ibc = interp(b, c, t),
-              icd = interp(c, d, t),
-              iabc = interp(iab, ibc, t),
-              ibcd = interp(ibc, icd, t);
-  return interp(iabc, ibcd, t);
+static inline float flatness(const float &q0, const float &d0, const float &q3, const float &d3) {
+  const float u = d0 - q3 + q0,   // 3*q1 - 2*q0 - q3
+              v = q0 - q3 + d3;   // 3*q2 - q0 - 2*q3, negated
+  return MAX(sq(u), sq(v));
 }
 
 /**
- * We approximate Euclidean distance with the sum of the coordinates
- * offset (so-called "norm 1"), which is quicker to compute.
+ * Evaluate the curve at new_t and test whether the piece from the point
+ * "from" at t to the new point is flat enough.
  */
-static inline float dist1(const float &x1, const float &y1, const float &x2, const float &y2) { return ABS(x1 - x2) + ABS(y1 - y2); }
+static bool flat_piece(const bezier_axis_t &bx, const bezier_axis_t &by, const bezier_point_t &from,
+                       const float &t, const float &new_t, bezier_point_t &to
+) {
+  to.x = eval_bezier(bx, new_t);
+  to.y = eval_bezier(by, new_t);
+  to.dx = eval_bezier_d(bx, new_t);
+  to.dy = eval_bezier_d(by, new_t);
+  const float h = new_t - t;
+  return h <= MIN_STEP
+      || flatness(from.x, from.dx * h, to.x, to.dx * h) + flatness(from.y, from.dy * h, to.y, to.dy * h) <= FLAT_LIMIT;
+}
 
 /**
- * The algorithm for computing the step is loosely based on the one in Kig
- * (See https://sources.debian.net/src/kig/4:15.08.3-1/misc/kigpainter.cpp/#L759)
- * However, we do not use the stack.
+ * Flatten a cubic Bézier curve into the fewest line segments that stay
+ * within BEZIER_TOLERANCE of it.
  *
- * The algorithm goes as it follows: the parameters t runs from 0.0 to
- * 1.0 describing the curve, which is evaluated by eval_bezier(). At
- * each iteration we have to choose a step, i.e., the increment of the
- * t variable. By default the step of the previous iteration is taken,
- * and then it is enlarged or reduced depending on how straight the
- * curve locally is. The step is always clamped between MIN_STEP/2 and
- * 2*MAX_STEP. MAX_STEP is taken at the first iteration.
+ * The parameter t runs from 0 to 1. Each segment starts where the last
+ * one ended and is nearly as long as the flatness test allows: the step
+ * is doubled from the last one while the piece stays flat, or halved
+ * until it is flat, then refined by a few bisections.
  *
- * For some t, the step value is considered acceptable if the curve in
- * the interval [t, t+step] is sufficiently straight, i.e.,
- * sufficiently close to linear interpolation. In practice the
- * following test is performed: the distance between eval_bezier(...,
- * t+step/2) is evaluated and compared with 0.5*(eval_bezier(...,
- * t)+eval_bezier(..., t+step)). If it is smaller than SIGMA, then the
- * step value is considered acceptable, otherwise it is not. The code
- * seeks to find the larger step value which is considered acceptable.
+ * A piece [t0, t1] of a cubic is again a cubic, with control points
+ * B(t0), B(t0) + h/3 B'(t0), B(t1) - h/3 B'(t1), B(t1) (h = t1 - t0).
+ * Such a piece lies within E of its chord if
  *
- * At every iteration the recorded step value is considered and then
- * iteratively halved until it becomes acceptable. If it was already
- * acceptable in the beginning (i.e., no halving were done), then
- * maybe it was necessary to enlarge it; then it is iteratively
- * doubled while it remains acceptable. The last acceptable value
- * found is taken, provided that it is between MIN_STEP and MAX_STEP
- * and does not bring t over 1.0.
+ *   max(ux^2, vx^2) + max(uy^2, vy^2) <= 16 E^2
  *
- * Caveat: this algorithm is not perfect, since it can happen that a
- * step is considered acceptable even when the curve is not linear at
- * all in the interval [t, t+step] (but its mid point coincides "by
- * chance" with the midpoint according to the parametrization). This
- * kind of glitches can be eliminated with proper first derivative
- * estimates; however, given the improbability of such configurations,
- * the mitigation offered by MIN_STEP and the small computational
- * power available on Arduino, I think it is not wise to implement it.
+ * with u = 3 q1 - 2 q0 - q3 and v = 3 q2 - q0 - 2 q3 for each axis.
+ * This bound never underestimates the error, so every segment is within
+ * the tolerance, and it needs no stack or recursion.
  */
 void cubic_b_spline(const float position[NUM_AXIS], const float target[NUM_AXIS], const float offset[4], float fr_mm_s, uint8_t extruder) {
   // Absolute first and second control points are recovered.
-  const float first0 = position[X_AXIS] + offset[0],
-              first1 = position[Y_AXIS] + offset[1],
-              second0 = target[X_AXIS] + offset[2],
-              second1 = target[Y_AXIS] + offset[3];
-  float t = 0;
+  const bezier_axis_t bx = { position[X_AXIS], position[X_AXIS] + offset[0], target[X_AXIS] + offset[2], target[X_AXIS] },
+                      by = { position[Y_AXIS], position[Y_AXIS] + offset[1], target[Y_AXIS] + offset[3], target[Y_AXIS] };
+
+  float bez_target[XYZE] = { position[X_AXIS], position[Y_AXIS], position[Z_AXIS], position[E_AXIS] },
+        t = 0, step = 0.5f;
 
-  float bez_target[4];
-  bez_target[X_AXIS] = position[X_AXIS];
-  bez_target[Y_AXIS] = position[Y_AXIS];
-  float step = MAX_STEP;
+  bezier_point_t point = { bx.p0, by.p0, eval_bezier_d(bx, 0), eval_bezier_d(by, 0) }, next, candidate;
 
   millis_t next_idle_ms = millis() + 200UL;
 
+  // Queue the segments as one planner batch
+  planner.begin_batch();
+
   while (t < 1) {
 
     thermalManager.manage_heater();
@@ -131,63 +144,58 @@ void cubic_b_spline(const float position[NUM_AXIS], const float target[NUM_AXIS]
       idle();
     }
 
-    // First try to reduce the step in order to make it sufficiently
-    // close to a linear interpolation.
-    bool did_reduce = false;
-    float new_t = t + step;
-    NOMORE(new_t, 1);
-    float new_pos0 = eval_bezier(position[X_AXIS], first0, second0, target[X_AXIS], new_t),
-          new_pos1 = eval_bezier(position[Y_AXIS], first1, second1, target[Y_AXIS], new_t);
+    // Bracket the longest flat step between good and bad
+    const float rest = 1 - t;
+    float good = 0, bad = 2 * rest, h = MIN(2 * step, rest);
     for (;;) {
-      if (new_t - t < (MIN_STEP)) break;
-      const float candidate_t = 0.5f * (t + new_t),
-                  candidate_pos0 = eval_bezier(position[X_AXIS], first0, second0, target[X_AXIS], candidate_t),
-                  candidate_pos1 = eval_bezier(position[Y_AXIS], first1, second1, target[Y_AXIS], candidate_t),
-                  interp_pos0 = 0.5f * (bez_target[X_AXIS] + new_pos0),
-                  interp_pos1 = 0.5f * (bez_target[Y_AXIS] + new_pos1);
-      if (dist1(candidate_pos0, candidate_pos1, interp_pos0, interp_pos1) <= (SIGMA)) break;
-      new_t = candidate_t;
-      new_pos0 = candidate_pos0;
-      new_pos1 = candidate_pos1;
-      did_reduce = true;
+      if (flat_piece(bx, by, point, t, t + h, candidate)) {
+        good = h;
+        next = candidate;
+        if (h >= rest) break;
+        h = MIN(2 * h, rest);
+        if (h >= bad) break;
+      }
+      else {
+        bad = h;
+        if (good) break;
+        h *= 0.5f;
+      }
     }
 
-    // If we did not reduce the step, maybe we should enlarge it.
-    if (!did_reduce) for (;;) {
-      if (new_t - t > MAX_STEP) break;
-      const float candidate_t = t + 2 * (new_t - t);
-      if (candidate_t >= 1) break;
-      const float candidate_pos0 = eval_bezier(position[X_AXIS], first0, second0, target[X_AXIS], candidate_t),
-                  candidate_pos1 = eval_bezier(position[Y_AXIS], first1, second1, target[Y_AXIS], candidate_t),
-                  interp_pos0 = 0.5f * (bez_target[X_AXIS] + candidate_pos0),
-                  interp_pos1 = 0.5f * (bez_target[Y_AXIS] + candidate_pos1);
-      if (dist1(new_pos0, new_pos1, interp_pos0, interp_pos1) > (SIGMA)) break;
-      new_t = candidate_t;
-      new_pos0 = candidate_pos0;
-      new_pos1 = candidate_pos1;
+    // Then narrow it down
+    for (uint8_t i = STEP_BISECTIONS; i-- && good < rest;) {
+      h = 0.5f * (good + bad);
+      if (flat_piece(bx, by, point, t, t + h, candidate)) {
+        good = h;
+        next = candidate;
+      }
+      else
+        bad = h;
     }
 
-    // Check some postcondition; they are disabled in the actual
-    // Marlin build, but if you test the same code on a computer you
-    // may want to check they are respect.
-    /*
-      assert(new_t <= 1.0);
-      if (new_t < 1.0) {
-        assert(new_t - t >= (MIN_STEP) / 2.0);
-        assert(new_t - t <= (MAX_STEP) * 2.0);
-      }
-    */
+    // Land exactly on the target at the end
+    float new_t = t + good;
+    if (1 - new_t < MIN_STEP) {
+      new_t = 1;
+      next.x = bx.p3;
+      next.y = by.p3;
+    }
+    point = next;
 
-    step = new_t - t;
+    step = good;
     t = new_t;
 
     // Compute and send new position
-    bez_target[X_AXIS] = new_pos0;
-    bez_target[Y_AXIS] = new_pos1;
+    const float seg_x = point.x - bez_target[X_AXIS],
+                seg_y = point.y - bez_target[Y_AXIS],
+                old_z = bez_target[Z_AXIS];
+    bez_target[X_AXIS] = point.x;
+    bez_target[Y_AXIS] = point.y;
     // FIXME. The following two are wrong, since the parameter t is
     // not linear in the distance.
     bez_target[Z_AXIS] = interp(position[Z_AXIS], target[Z_AXIS], t);
     bez_target[E_AXIS] = interp(position[E_AXIS], target[E_AXIS], t);
+    const float seg_mm = SQRT(sq(seg_x) + sq(seg_y) + sq(bez_target[Z_AXIS] - old_z));
     clamp_to_software_endstops(bez_target);
 
     #if HAS_LEVELING && !PLANNER_LEVELING
@@ -197,9 +205,11 @@ void cubic_b_spline(const float position[NUM_AXIS], const float target[NUM_AXIS]
       const float (&pos)[XYZE] = bez_target;
     #endif
 
-    if (!planner.buffer_line(pos, fr_mm_s, active_extruder, step))
+    if (!planner.buffer_line(pos, fr_mm_s, active_extruder, seg_mm))
       break;
   }
+
+  planner.end_batch();
 }
 
 #endif // BEZIER_CURVE_SUPPORT
@@ -37,6 +37,12 @@ Stopwatch print_job_timer;      // Global Print Job Timer instance
 #include "../Marlin.h"
 #include "../HAL/shared/persistent_store_api.h"
 
+#if ENABLED(PRINTCOUNTER_MAINTENANCE)
+  #include "motion.h"
+  #include "temperature.h"
+  #define STATS_RING_START int(persistentStore.capacity() - 128 - STATS_RING_SIZE)
+#endif
+
 PrintCounter print_job_timer;   // Global Print Job Timer instance
 
 printStatistics PrintCounter::data;
@@ -46,6 +52,12 @@ const PrintCounter::promdress PrintCounter::address = STATS_EEPROM_ADDRESS;
 millis_t PrintCounter::lastDuration;
 bool PrintCounter::loaded = false;
 
+#if ENABLED(PRINTCOUNTER_MAINTENANCE)
+  printMaintenance PrintCounter::maint;
+  uint8_t PrintCounter::nextSlot;
+  float PrintCounter::travelFrac[XYZ], PrintCounter::filamentFrac[EXTRUDERS];
+#endif
+
 millis_t PrintCounter::deltaDuration() {
   #if ENABLED(DEBUG_PRINTCOUNTER)
     debug(PSTR("deltaDuration"));
@@ -65,8 +77,113 @@ void PrintCounter::incFilamentUsed(float const &amount) {
   if (!isLoaded()) return;
 
   data.filamentUsed += amount; // mm
+
+  #if ENABLED(PRINTCOUNTER_MAINTENANCE)
+    // Only whole mm go to the total, so small moves aren't lost in a large one
+    float &frac = filamentFrac[active_extruder];
+    frac += amount;
+    if (ABS(frac) >= 1) {
+      const int32_t mm = frac;
+      uint32_t &total = maint.filament[active_extruder];
+      if (mm > 0 || total >= uint32_t(-mm)) total += mm;
+      frac -= mm;
+    }
+  #endif
 }
 
+#if ENABLED(PRINTCOUNTER_MAINTENANCE)
+
+  void PrintCounter::incAxisTravel(const AxisEnum axis, float const &amount) {
+    if (!isLoaded()) return;
+
+    float &frac = travelFrac[axis];
+    frac += ABS(amount);
+    if (frac >= 1) {
+      const uint32_t mm = frac;
+      maint.travel[axis] += mm;
+      frac -= mm;
+    }
+  }
+
+  void PrintCounter::incThermalError(const int8_t heater) {
+    if (heater < -1) return;                  // Only hotends and the bed are counted
+    const uint8_t h = heater < 0 ? HOTENDS : heater;
+    if (h < STATS_HEATERS) maint.thermalErrors[h]++;
+  }
+
+  /**
+   * Load the newest record with a good CRC. Return false if there
+   * is none, e.g. on first use, leaving all counters at zero.
+   */
+  bool PrintCounter::loadMaintenance() {
+    bool found = false;
+    persistentStore.access_start();
+    for (uint8_t i = 0; i < PRINTCOUNTER_SLOTS; i++) {
+      printMaintenance rec;
+      persistentStore.read_data(STATS_RING_START + i * sizeof(rec), (uint8_t*)&rec, sizeof(rec));
+      uint16_t crc = 0;
+      crc16(&crc, &rec, offsetof(printMaintenance, crc));
+      if (rec.sequence && crc == rec.crc && (!found || int32_t(rec.sequence - maint.sequence) > 0)) {
+        maint = rec;
+        nextSlot = (i + 1) % (PRINTCOUNTER_SLOTS);
+        found = true;
+      }
+    }
+    persistentStore.access_finish();
+
+    if (!found) {
+      memset(&maint, 0, sizeof(maint));
+      nextSlot = 0;
+    }
+    return found;
+  }
+
+  /**
+   * Write the counters to the next slot of the ring. A write cut short
+   * spoils only that slot, and the previous one is loaded instead.
+   */
+  void PrintCounter::saveMaintenance() {
+    maint.stats = data;
+    maint.sequence++;
+    maint.crc = 0;
+    crc16(&maint.crc, &maint, offsetof(printMaintenance, crc));
+
+    persistentStore.access_start();
+    persistentStore.write_data(STATS_RING_START + nextSlot * sizeof(maint), (uint8_t*)&maint, sizeof(maint));
+    persistentStore.access_finish();
+
+    if (++nextSlot >= PRINTCOUNTER_SLOTS) nextSlot = 0;
+  }
+
+  template<typename T>
+  static void echo_array(const T *values, const uint8_t count) {
+    SERIAL_CHAR('[');
+    for (uint8_t i = 0; i < count; i++) {
+      if (i) SERIAL_CHAR(',');
+      SERIAL_ECHO(values[i]);
+    }
+    SERIAL_CHAR(']');
+  }
+
+  void PrintCounter::reportMaintenance() {
+    SERIAL_ECHOPAIR("{\"prints\":", data.totalPrints);
+    SERIAL_ECHOPAIR(",\"finished\":", data.finishedPrints);
+    SERIAL_ECHOPAIR(",\"printTime\":", data.printTime);
+    SERIAL_ECHOPAIR(",\"longestPrint\":", data.longestPrint);
+    SERIAL_ECHOPGM(",\"travel\":");
+    echo_array(maint.travel, XYZ);
+    SERIAL_ECHOPGM(",\"filament\":");
+    echo_array(maint.filament, EXTRUDERS);
+    SERIAL_ECHOPGM(",\"heaterTime\":");
+    echo_array(maint.heaterTime, STATS_HEATERS);
+    SERIAL_ECHOPGM(",\"thermalErrors\":");
+    echo_array(maint.thermalErrors, STATS_HEATERS);
+    SERIAL_ECHOPAIR(",\"commits\":", maint.sequence);
+    SERIAL_ECHOLNPGM("}");
+  }
+
+#endif // PRINTCOUNTER_MAINTENANCE
+
 void PrintCounter::initStats() {
   #if ENABLED(DEBUG_PRINTCOUNTER)
     debug(PSTR("initStats"));
@@ -75,6 +192,15 @@ void PrintCounter::initStats() {
   loaded = true;
   data = { 0, 0, 0, 0, 0.0 };
 
+  #if ENABLED(PRINTCOUNTER_MAINTENANCE)
+    // Keep the sequence so the cleared record is the newest
+    const uint32_t sequence = maint.sequence;
+    memset(&maint, 0, sizeof(maint));
+    maint.sequence = sequence;
+    ZERO(travelFrac);
+    ZERO(filamentFrac);
+  #endif
+
   saveStats();
   persistentStore.access_start();
   persistentStore.write_data(address, (uint8_t)0x16);
@@ -86,6 +212,15 @@ void PrintCounter::loadStats() {
     debug(PSTR("loadStats"));
   #endif
 
+  #if ENABLED(PRINTCOUNTER_MAINTENANCE)
+    if (loadMaintenance()) {
+      data = maint.stats;
+      loaded = true;
+      return;
+    }
+    // No record yet. Start from the older counters, if any.
+  #endif
+
   // Check if the EEPROM block is initialized
   uint8_t value = 0;
   persistentStore.access_start();
@@ -107,9 +242,13 @@ void PrintCounter::saveStats() {
   if (!isLoaded()) return;
 
   // Saves the struct to EEPROM
-  persistentStore.access_start();
-  persistentStore.write_data(address + sizeof(uint8_t), (uint8_t*)&data, sizeof(printStatistics));
-  persistentStore.access_finish();
+  #if ENABLED(PRINTCOUNTER_MAINTENANCE)
+    saveMaintenance();
+  #else
+    persistentStore.access_start();
+    persistentStore.write_data(address + sizeof(uint8_t), (uint8_t*)&data, sizeof(printStatistics));
+    persistentStore.access_finish();
+  #endif
 
   #if ENABLED(EXTENSIBLE_UI) && ENABLED(LULZBOT_PRINTCOUNTER)
     ExtUI::onStoreSettings();
@@ -169,10 +308,27 @@ void PrintCounter::showStats() {
 }
 
 void PrintCounter::tick() {
-  if (!isRunning()) return;
-
   millis_t now = millis();
 
+  #if ENABLED(PRINTCOUNTER_MAINTENANCE)
+    // Heaters are counted with or without a job
+    static millis_t heater_next; // = 0
+    static bool heating; // = false
+    if (ELAPSED(now, heater_next)) {
+      heater_next = now + 1000UL;
+      bool on = false;
+      HOTEND_LOOP() if (thermalManager.degTargetHotend(e)) { maint.heaterTime[e]++; on = true; }
+      #if HAS_HEATED_BED
+        if (thermalManager.degTargetBed()) { maint.heaterTime[HOTENDS]++; on = true; }
+      #endif
+      // Without a running job nothing else would save the time just counted
+      if (heating && !on && !isRunning()) saveStats();
+      heating = on;
+    }
+  #endif
+
+  if (!isRunning()) return;
+
   static uint32_t update_next; // = 0
   if (ELAPSED(now, update_next)) {
     #if ENABLED(DEBUG_PRINTCOUNTER)
@@ -44,6 +44,26 @@ struct printStatistics {    // 16 bytes
   float    filamentUsed;    // Accumulated filament consumed in mm
 };
 
+#if ENABLED(PRINTCOUNTER_MAINTENANCE)
+
+  #define STATS_HEATERS (HOTENDS + HAS_HEATED_BED)  // Hotends, then the bed
+
+  struct printMaintenance {
+    uint32_t sequence;                    // Commit count, the newest valid record is loaded
+    printStatistics stats;                // The counters above
+    uint32_t travel[XYZ],                 // Commanded travel per axis in mm
+             filament[EXTRUDERS],         // Filament per extruder in mm
+             heaterTime[STATS_HEATERS];   // Seconds with a target temperature set
+    uint16_t thermalErrors[STATS_HEATERS],// Thermal faults per heater
+             crc;
+  };
+
+  // The records are written in turn to a ring just below the 128 bytes
+  // kept at the end of the persistent store
+  #define STATS_RING_SIZE (sizeof(printMaintenance) * (PRINTCOUNTER_SLOTS))
+
+#endif
+
 class PrintCounter: public Stopwatch {
   private:
     typedef Stopwatch super;
@@ -56,6 +76,14 @@ class PrintCounter: public Stopwatch {
 
     static printStatistics data;
 
+    #if ENABLED(PRINTCOUNTER_MAINTENANCE)
+      static printMaintenance maint;
+      static uint8_t nextSlot;
+      static float travelFrac[XYZ], filamentFrac[EXTRUDERS]; // Parts of a mm not yet counted
+      static bool loadMaintenance();
+      static void saveMaintenance();
+    #endif
+
     /**
      * @brief EEPROM address
      * @details Defines the start offset address where the data is stored.
@@ -128,6 +156,31 @@ class PrintCounter: public Stopwatch {
      */
     static void incFilamentUsed(float const &amount);
 
+    #if ENABLED(PRINTCOUNTER_MAINTENANCE)
+      /**
+       * @brief Increment the travel of an axis
+       * @details Moves in either direction count toward the total.
+       *
+       * @param axis The axis that moved
+       * @param amount The distance moved in mm
+       */
+      static void incAxisTravel(const AxisEnum axis, float const &amount);
+
+      /**
+       * @brief Count a thermal fault
+       * @details Only counts the fault in RAM, since it may be called from
+       * the temperature ISR. The caller saves with saveStats() before halting.
+       *
+       * @param heater The heater index, or -1 for the bed. Others are ignored.
+       */
+      static void incThermalError(const int8_t heater);
+
+      /**
+       * @brief Serial output all counters as one line of JSON
+       */
+      static void reportMaintenance();
+    #endif
+
     /**
      * @brief Reset the Print Statistics
      * @details Reset the statistics to zero and saves them to EEPROM creating
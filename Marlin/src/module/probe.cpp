@@ -56,6 +56,12 @@
 
 float zprobe_zoffset; // Initialized by settings.load()
 
+#if ENABLED(ADAPTIVE_PROBING)
+  #include "../libs/sample_stats.h"
+  float probe_sigma;      // Spread of the samples kept at the last point
+  uint8_t probe_samples;  // Samples taken at the last point
+#endif
+
 #if HAS_Z_SERVO_PROBE
   #include "../module/servo.h"
 #endif
@@ -544,6 +550,14 @@ static bool do_probe_move(const float z, const float fr_mm_s) {
     }
   #endif
 
+  // Travel queued by probe_pt has to finish before the probe, drivers or
+  // steppers are reconfigured, and before the quiet probing settle delay
+  // starts. On kinematic machines the travel also drives the towers down,
+  // so let it end before the probe move is queued behind it.
+  #if IS_KINEMATIC || ENABLED(BLTOUCH) || ENABLED(SENSORLESS_PROBING) || ENABLED(PROBING_STEPPERS_OFF) || QUIET_PROBING
+    planner.synchronize();
+  #endif
+
   // Deploy BLTouch at the start of any probe
   #if ENABLED(BLTOUCH)
     if (set_bltouch_deployed(true)) return true;
@@ -653,6 +667,10 @@ static float run_z_probe() {
       if (DEBUGGING(LEVELING)) SERIAL_ECHOLNPAIR("1st Probe Z:", first_probe_z);
     #endif
 
+    #if ENABLED(ADAPTIVE_PROBING)
+      UNUSED(first_probe_z); // The fast probe only finds the bed. The samples come after.
+    #endif
+
     // move up to make clearance for the probe
     do_blocking_move_to_z(current_position[Z_AXIS] + Z_CLEARANCE_MULTI_PROBE, MMM_TO_MMS(Z_PROBE_SPEED_FAST));
 
@@ -668,7 +686,11 @@ static float run_z_probe() {
     }
   #endif
 
-  #if MULTIPLE_PROBING > 2
+  #if ENABLED(ADAPTIVE_PROBING)
+    float samples[ADAPTIVE_PROBING_MAX_SAMPLES];
+    sample_stats stats;
+    for (;;) {
+  #elif MULTIPLE_PROBING > 2
     float probes_total = 0;
     for (uint8_t p = MULTIPLE_PROBING + 1; --p;) {
   #endif
@@ -688,13 +710,48 @@ static float run_z_probe() {
         measure_backlash_with_probe();
       #endif
 
-  #if MULTIPLE_PROBING > 2
+  #if ENABLED(ADAPTIVE_PROBING)
+      samples[stats.count] = current_position[Z_AXIS];
+      stats.add(current_position[Z_AXIS]);
+
+      #if ENABLED(DEBUG_LEVELING_FEATURE)
+        if (DEBUGGING(LEVELING)) {
+          SERIAL_ECHOPAIR("Sample ", int(stats.count));
+          SERIAL_ECHOPAIR(" Z:", current_position[Z_AXIS]);
+          SERIAL_ECHOLNPAIR_F(" Sigma:", stats.sigma(), 5);
+        }
+      #endif
+
+      // Stop early once the samples agree, or at the sample limit
+      if (stats.count >= ADAPTIVE_PROBING_MAX_SAMPLES
+        || (stats.count >= ADAPTIVE_PROBING_MIN_SAMPLES && stats.sigma() <= ADAPTIVE_PROBING_TOLERANCE)
+      ) break;
+
+      do_blocking_move_to_z(current_position[Z_AXIS] + Z_CLEARANCE_MULTI_PROBE, MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+    }
+  #elif MULTIPLE_PROBING > 2
       probes_total += current_position[Z_AXIS];
       if (p > 1) do_blocking_move_to_z(current_position[Z_AXIS] + Z_CLEARANCE_MULTI_PROBE, MMM_TO_MMS(Z_PROBE_SPEED_FAST));
     }
   #endif
 
-  #if MULTIPLE_PROBING > 2
+  #if ENABLED(ADAPTIVE_PROBING)
+
+    // Average the samples that agree with the median
+    sample_stats kept;
+    const float measured_z = samples_robust_mean(samples, stats.count, ADAPTIVE_PROBING_MAD_LIMIT, ADAPTIVE_PROBING_TOLERANCE, kept);
+    probe_sigma = kept.sigma();
+    probe_samples = stats.count;
+
+    #if ENABLED(DEBUG_LEVELING_FEATURE)
+      if (DEBUGGING(LEVELING)) {
+        SERIAL_ECHOPAIR("Kept ", int(kept.count));
+        SERIAL_ECHOPAIR(" of ", int(stats.count));
+        SERIAL_ECHOLNPAIR(" samples. Z:", measured_z);
+      }
+    #endif
+
+  #elif MULTIPLE_PROBING > 2
 
     // Return the average value of all probes
     const float measured_z = probes_total * (1.0f / (MULTIPLE_PROBING));
@@ -760,7 +817,7 @@ float probe_pt(const float &rx, const float &ry, const ProbePtRaise raise_after/
 
   const float nz =
     #if ENABLED(DELTA)
-      // Move below clip height or xy move will be aborted by do_blocking_move_to
+      // Move below clip height or xy move will be aborted by plan_move_to
       MIN(current_position[Z_AXIS], delta_clip_start_height)
     #else
       current_position[Z_AXIS]
@@ -770,8 +827,9 @@ float probe_pt(const float &rx, const float &ry, const ProbePtRaise raise_after/
   const float old_feedrate_mm_s = feedrate_mm_s;
   feedrate_mm_s = XY_PROBE_FEEDRATE_MM_S;
 
-  // Move the probe to the starting XYZ
-  do_blocking_move_to(nx, ny, nz);
+  // Queue the move to the starting XYZ. The probe move in run_z_probe
+  // is the first point that waits, so the travel runs straight into it.
+  plan_move_to(nx, ny, nz);
 
   float measured_z = NAN;
   if (!DEPLOY_PROBE()) {
@@ -779,7 +837,7 @@ float probe_pt(const float &rx, const float &ry, const ProbePtRaise raise_after/
 
     const bool big_raise = raise_after == PROBE_PT_BIG_RAISE;
     if (big_raise || raise_after == PROBE_PT_RAISE)
-      do_blocking_move_to_z(current_position[Z_AXIS] + (big_raise ? 25 : Z_CLEARANCE_BETWEEN_PROBES), MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+      plan_move_to_z(current_position[Z_AXIS] + (big_raise ? 25 : Z_CLEARANCE_BETWEEN_PROBES), MMM_TO_MMS(Z_PROBE_SPEED_FAST));
     else if (raise_after == PROBE_PT_STOW)
       if (STOW_PROBE()) measured_z = NAN;
   }
@@ -787,7 +845,13 @@ float probe_pt(const float &rx, const float &ry, const ProbePtRaise raise_after/
   if (verbose_level > 2) {
     SERIAL_ECHOPAIR_F("Bed X: ", LOGICAL_X_POSITION(rx), 3);
     SERIAL_ECHOPAIR_F(" Y: ", LOGICAL_Y_POSITION(ry), 3);
-    SERIAL_ECHOLNPAIR_F(" Z: ", measured_z, 3);
+    #if ENABLED(ADAPTIVE_PROBING)
+      SERIAL_ECHOPAIR_F(" Z: ", measured_z, 3);
+      SERIAL_ECHOPAIR(" Samples: ", int(probe_samples));
+      SERIAL_ECHOLNPAIR_F(" Sigma: ", probe_sigma, 4);
+    #else
+      SERIAL_ECHOLNPAIR_F(" Z: ", measured_z, 3);
+    #endif
   }
 
   feedrate_mm_s = old_feedrate_mm_s;
@@ -29,6 +29,10 @@
 
 #if HAS_BED_PROBE
   extern float zprobe_zoffset;
+  #if ENABLED(ADAPTIVE_PROBING)
+    extern float probe_sigma;
+    extern uint8_t probe_samples;
+  #endif
   bool set_probe_deployed(const bool deploy);
   #ifdef Z_AFTER_PROBING
     void move_z_after_probing();
@@ -119,6 +119,11 @@ Stepper stepper; // Singleton
   bool Stepper::separate_multi_axis = false;
 #endif
 
+#if ENABLED(PARALLEL_HOMING)
+  uint8_t Stepper::homing_axes = 0;
+  volatile uint8_t Stepper::homing_stopped = 0;
+#endif
+
 #if HAS_MOTOR_CURRENT_PWM
   uint32_t Stepper::motor_current_setting[3]; // Initialized by settings.load()
 #endif
@@ -166,6 +171,12 @@ uint32_t Stepper::advance_dividend[XYZE] = { 0 },
          Stepper::decelerate_after,          // The point from where we need to start decelerating
          Stepper::step_event_count;          // The total event count for the current block
 
+#if ENABLED(NATIVE_ARC_BLOCKS)
+  ArcWalker Stepper::arc_walker;
+  uint32_t Stepper::advance_divisor_xy,
+           Stepper::arc_chord_events;
+#endif
+
 #if EXTRUDERS > 1 || ENABLED(MIXING_EXTRUDER)
   uint8_t Stepper::stepper_extruder;
 #else
@@ -201,6 +212,16 @@ uint32_t Stepper::nextMainISR = 0;
 
 #endif // LIN_ADVANCE
 
+#if ENABLED(INPUT_SHAPING)
+  ShapedAxis Stepper::shaping[2];
+  uint32_t Stepper::nextShapingISR = SHAPING_NEVER,
+           Stepper::shaping_time = 0;
+  uint8_t Stepper::shaping_dir_bits = 0;
+  ShaperType Stepper::shaper_type[2] = { SHAPING_TYPE, SHAPING_TYPE };
+  float Stepper::shaper_frequency[2] = { SHAPING_FREQ_X, SHAPING_FREQ_Y },
+        Stepper::shaper_damping[2] = { SHAPING_DAMPING_X, SHAPING_DAMPING_Y };
+#endif
+
 int32_t Stepper::ticks_nominal = -1;
 #if DISABLED(S_CURVE_ACCELERATION)
   uint32_t Stepper::acc_step_rate; // needed for deceleration start point
@@ -370,6 +391,11 @@ void Stepper::set_directions() {
     SET_STEP_DIR(Z); // C
   #endif
 
+  #if ENABLED(INPUT_SHAPING)
+    // The pins now follow the block. Shaped steps flip them as needed.
+    shaping_dir_bits = last_direction_bits & (_BV(X_AXIS) | _BV(Y_AXIS));
+  #endif
+
   #if DISABLED(LIN_ADVANCE)
     #if ENABLED(MIXING_EXTRUDER)
        // Because this is valid for the whole block we don't know
@@ -400,6 +426,48 @@ void Stepper::set_directions() {
   #endif
 }
 
+#if ENABLED(NATIVE_ARC_BLOCKS)
+
+  /**
+   * Set up Bresenham for the next chord of an arc block. X and Y are traced
+   * over the chord, while Z and E carry on over the whole block.
+   */
+  void Stepper::next_arc_chord() {
+    int32_t delta[2];
+    uint32_t events;
+    do {
+      if (!arc_walker.next(delta, events)) {
+        // No chords left. Any remaining events only move Z and E.
+        advance_dividend[X_AXIS] = advance_dividend[Y_AXIS] = 0;
+        arc_chord_events = step_event_count - step_events_completed;
+        return;
+      }
+    } while (!events);
+
+    // Chords may turn X and Y around
+    uint8_t dir_bits = last_direction_bits;
+    #define ARC_CHORD_DIR(AXIS) do{ \
+      if (delta[AXIS] < 0) { delta[AXIS] = -delta[AXIS]; SBI(dir_bits, AXIS); } \
+      else CBI(dir_bits, AXIS); \
+    }while(0)
+    ARC_CHORD_DIR(X_AXIS);
+    ARC_CHORD_DIR(Y_AXIS);
+    if (dir_bits != last_direction_bits) {
+      last_direction_bits = dir_bits;
+      set_directions();
+    }
+
+    // The chord may have more events than steps, so the tool speed stays even
+    events <<= oversampling_factor;
+    arc_chord_events = events;
+    advance_divisor_xy = events << 1;
+    advance_dividend[X_AXIS] = delta[X_AXIS] << 1;
+    advance_dividend[Y_AXIS] = delta[Y_AXIS] << 1;
+    delta_error[X_AXIS] = delta_error[Y_AXIS] = -int32_t(events);
+  }
+
+#endif // NATIVE_ARC_BLOCKS
+
 #if ENABLED(S_CURVE_ACCELERATION)
   /**
    *  This uses a quintic (fifth-degree) Bézier polynomial for the velocity curve, giving
@@ -1257,6 +1325,11 @@ void Stepper::isr() {
       if (!nextAdvanceISR) nextAdvanceISR = Stepper::advance_isr();
     #endif
 
+    #if ENABLED(INPUT_SHAPING)
+      // Run the input shaping ISR if we have to
+      if (!nextShapingISR) nextShapingISR = Stepper::shaping_isr();
+    #endif
+
     // ^== Time critical. NOTHING besides pulse generation should be above here!!!
 
     // Run main stepping block processing ISR if we have to
@@ -1270,6 +1343,10 @@ void Stepper::isr() {
       #endif
     ;
 
+    #if ENABLED(INPUT_SHAPING)
+      NOMORE(interval, nextShapingISR);
+    #endif
+
     // Limit the value to the maximum possible value of the timer
     NOMORE(interval, HAL_TIMER_TYPE_MAX);
 
@@ -1281,6 +1358,12 @@ void Stepper::isr() {
       if (nextAdvanceISR != LA_ADV_NEVER) nextAdvanceISR -= interval;
     #endif
 
+    #if ENABLED(INPUT_SHAPING)
+      // Compute the time remaining for the shaping isr, and keep the clock
+      if (nextShapingISR != SHAPING_NEVER) nextShapingISR -= interval;
+      shaping_time += interval;
+    #endif
+
     /**
      * This needs to avoid a race-condition caused by interleaving
      * of interrupts required by both the LA and Stepper algorithms.
@@ -1353,6 +1436,33 @@ void Stepper::isr() {
   ENABLE_ISRS();
 }
 
+#if ENABLED(INPUT_SHAPING)
+
+  #if MINIMUM_STEPPER_DIR_DELAY > 0
+    #define SHAPED_DIR_DELAY() DELAY_NS(MINIMUM_STEPPER_DIR_DELAY)
+  #else
+    #define SHAPED_DIR_DELAY() NOOP
+  #endif
+
+  // Start a pulse if the motor is half a step off the shaped position,
+  // turning the motor around first if needed
+  #define SHAPED_STEP_START(AXIS) do{ \
+    const int8_t step = shaping[_AXIS(AXIS)].step_due(); \
+    if (step) { \
+      if ((step < 0) != TEST(shaping_dir_bits, _AXIS(AXIS))) { \
+        shaping_dir_bits ^= _BV(_AXIS(AXIS)); \
+        AXIS##_APPLY_DIR(step < 0 ? INVERT_## AXIS ##_DIR : !INVERT_## AXIS ##_DIR, false); \
+        SHAPED_DIR_DELAY(); \
+      } \
+      AXIS##_APPLY_STEP(!INVERT_## AXIS ##_STEP_PIN, 0); \
+      count_position[_AXIS(AXIS)] += step; \
+    } \
+  }while(0)
+
+  #define SHAPED_STEP_STOP(AXIS) AXIS##_APPLY_STEP(INVERT_## AXIS ##_STEP_PIN, 0)
+
+#endif
+
 /**
  * This phase of the ISR should ONLY create the pulses for the steppers.
  * This prevents jitter caused by the interval between the start of the
@@ -1370,6 +1480,12 @@ void Stepper::stepper_pulse_phase_isr() {
       current_block = NULL;
       planner.discard_current_block();
     }
+    #if ENABLED(INPUT_SHAPING)
+      // Drop the echoes of the aborted moves
+      shaping[X_AXIS].reset();
+      shaping[Y_AXIS].reset();
+      nextShapingISR = SHAPING_NEVER;
+    #endif
   }
 
   // If there is no current block, do nothing
@@ -1379,6 +1495,15 @@ void Stepper::stepper_pulse_phase_isr() {
   const uint32_t pending_events = step_event_count - step_events_completed;
   uint8_t events_to_do = MIN(pending_events, steps_per_isr);
 
+  #if ENABLED(NATIVE_ARC_BLOCKS)
+    // An arc block is traced one chord at a time
+    if (TEST(current_block->flag, BLOCK_BIT_ARC)) {
+      NOMORE(events_to_do, arc_chord_events);
+      if (!events_to_do) return;
+      arc_chord_events -= events_to_do;
+    }
+  #endif
+
   // Just update the value we will get at the end of the loop
   step_events_completed += events_to_do;
 
@@ -1393,29 +1518,61 @@ void Stepper::stepper_pulse_phase_isr() {
     #define _APPLY_STEP(AXIS) AXIS ##_APPLY_STEP
     #define _INVERT_STEP_PIN(AXIS) INVERT_## AXIS ##_STEP_PIN
 
+    // An axis stopped by parallel homing takes no more steps
+    #if ENABLED(PARALLEL_HOMING)
+      #define _AXIS_RUNNING(AXIS) && !TEST(homing_stopped, _AXIS(AXIS))
+    #else
+      #define _AXIS_RUNNING(AXIS)
+    #endif
+
     // Start an active pulse, if Bresenham says so, and update position
     #define PULSE_START(AXIS) do{ \
       delta_error[_AXIS(AXIS)] += advance_dividend[_AXIS(AXIS)]; \
-      if (delta_error[_AXIS(AXIS)] >= 0) { \
+      if (delta_error[_AXIS(AXIS)] >= 0 _AXIS_RUNNING(AXIS)) { \
         _APPLY_STEP(AXIS)(!_INVERT_STEP_PIN(AXIS), 0); \
         count_position[_AXIS(AXIS)] += count_direction[_AXIS(AXIS)]; \
       } \
     }while(0)
 
+    // Arc chords have their own divisor for X and Y
+    #if ENABLED(NATIVE_ARC_BLOCKS)
+      #define _ADVANCE_DIVISOR(AXIS) (_AXIS(AXIS) <= Y_AXIS ? advance_divisor_xy : advance_divisor)
+    #else
+      #define _ADVANCE_DIVISOR(AXIS) advance_divisor
+    #endif
+
     // Stop an active pulse, if any, and adjust error term
     #define PULSE_STOP(AXIS) do { \
       if (delta_error[_AXIS(AXIS)] >= 0) { \
-        delta_error[_AXIS(AXIS)] -= advance_divisor; \
+        delta_error[_AXIS(AXIS)] -= _ADVANCE_DIVISOR(AXIS); \
         _APPLY_STEP(AXIS)(_INVERT_STEP_PIN(AXIS), 0); \
       } \
     }while(0)
 
-    // Pulse start
-    #if HAS_X_STEP
-      PULSE_START(X);
+    #if ENABLED(INPUT_SHAPING)
+      // Bresenham only makes step events for X and Y. The shaper makes the steps.
+      #define SHAPED_PULSE_START(AXIS) do{ \
+        delta_error[_AXIS(AXIS)] += advance_dividend[_AXIS(AXIS)]; \
+        if (delta_error[_AXIS(AXIS)] >= 0) { \
+          delta_error[_AXIS(AXIS)] -= _ADVANCE_DIVISOR(AXIS); \
+          if (shaping[_AXIS(AXIS)].add_event(shaping_time, !motor_direction(_AXIS(AXIS)))) \
+            NOMORE(nextShapingISR, shaping[_AXIS(AXIS)].delay[1]); \
+        } \
+        SHAPED_STEP_START(AXIS); \
+      }while(0)
     #endif
-    #if HAS_Y_STEP
-      PULSE_START(Y);
+
+    // Pulse start
+    #if ENABLED(INPUT_SHAPING)
+      SHAPED_PULSE_START(X);
+      SHAPED_PULSE_START(Y);
+    #else
+      #if HAS_X_STEP
+        PULSE_START(X);
+      #endif
+      #if HAS_Y_STEP
+        PULSE_START(Y);
+      #endif
     #endif
     #if HAS_Z_STEP
       PULSE_START(Z);
@@ -1452,11 +1609,16 @@ void Stepper::stepper_pulse_phase_isr() {
     if (signed(added_step_ticks) > 0) pulse_end += hal_timer_t(added_step_ticks);
 
     // Pulse stop
-    #if HAS_X_STEP
-      PULSE_STOP(X);
-    #endif
-    #if HAS_Y_STEP
-      PULSE_STOP(Y);
+    #if ENABLED(INPUT_SHAPING)
+      SHAPED_STEP_STOP(X);
+      SHAPED_STEP_STOP(Y);
+    #else
+      #if HAS_X_STEP
+        PULSE_STOP(X);
+      #endif
+      #if HAS_Y_STEP
+        PULSE_STOP(Y);
+      #endif
     #endif
     #if HAS_Z_STEP
       PULSE_STOP(Z);
@@ -1515,6 +1677,11 @@ uint32_t Stepper::stepper_block_phase_isr() {
     else {
       // Step events not completed yet...
 
+      #if ENABLED(NATIVE_ARC_BLOCKS)
+        // Move on to the next chord of an arc block
+        if (!arc_chord_events && TEST(current_block->flag, BLOCK_BIT_ARC)) next_arc_chord();
+      #endif
+
       // Are we in acceleration phase ?
       if (step_events_completed <= accelerate_until) { // Calculate new timer value
 
@@ -1733,6 +1900,9 @@ uint32_t Stepper::stepper_block_phase_isr() {
 
       // Calculate Bresenham divisor
       advance_divisor = step_event_count << 1;
+      #if ENABLED(NATIVE_ARC_BLOCKS)
+        advance_divisor_xy = advance_divisor;
+      #endif
 
       // No step events completed so far
       step_events_completed = 0;
@@ -1778,6 +1948,14 @@ uint32_t Stepper::stepper_block_phase_isr() {
         set_directions();
       }
 
+      #if ENABLED(NATIVE_ARC_BLOCKS)
+        // Start an arc block on its first chord
+        if (TEST(current_block->flag, BLOCK_BIT_ARC)) {
+          arc_walker.start(current_block->arc);
+          next_arc_chord();
+        }
+      #endif
+
       // At this point, we must ensure the movement about to execute isn't
       // trying to force the head against a limit switch. If using interrupt-
       // driven change detection, and already against a limit then no call to
@@ -1904,6 +2082,62 @@ uint32_t Stepper::stepper_block_phase_isr() {
   }
 #endif // LIN_ADVANCE
 
+#if ENABLED(INPUT_SHAPING)
+
+  // Timer interrupt for the echoes of X and Y step events
+  uint32_t Stepper::shaping_isr() {
+    const uint32_t next_x = shaping[X_AXIS].apply_echoes(shaping_time),
+                   next_y = shaping[Y_AXIS].apply_echoes(shaping_time);
+
+    // Get the timer count and estimate the end of the pulse
+    hal_timer_t pulse_end = HAL_timer_get_count(PULSE_TIMER_NUM) + hal_timer_t(MIN_PULSE_TICKS);
+
+    const hal_timer_t added_step_ticks = hal_timer_t(ADDED_STEP_TICKS);
+
+    // Step X and Y until they catch up with the shaped position
+    while (shaping[X_AXIS].step_pending() || shaping[Y_AXIS].step_pending()) {
+
+      SHAPED_STEP_START(X);
+      SHAPED_STEP_START(Y);
+
+      // Enforce a minimum duration for STEP pulse ON
+      #if MINIMUM_STEPPER_PULSE
+        while (HAL_timer_get_count(PULSE_TIMER_NUM) < pulse_end) { /* nada */ }
+      #endif
+
+      // Add the delay needed to ensure the maximum driver rate is enforced
+      if (signed(added_step_ticks) > 0) pulse_end += hal_timer_t(added_step_ticks);
+
+      SHAPED_STEP_STOP(X);
+      SHAPED_STEP_STOP(Y);
+
+      // For minimum pulse time wait before looping
+      if (shaping[X_AXIS].step_pending() || shaping[Y_AXIS].step_pending()) {
+        while (HAL_timer_get_count(PULSE_TIMER_NUM) < pulse_end) { /* nada */ }
+        #if MINIMUM_STEPPER_PULSE
+          pulse_end += hal_timer_t(MIN_PULSE_TICKS);
+        #endif
+      }
+    }
+
+    return MIN(next_x, next_y);
+  }
+
+  void Stepper::set_shaper(const AxisEnum axis, const ShaperType type, const float &frequency, const float &damping) {
+    shaper_type[axis] = type;
+    shaper_frequency[axis] = frequency;
+    shaper_damping[axis] = damping;
+
+    const bool was_enabled = STEPPER_ISR_ENABLED();
+    if (was_enabled) DISABLE_STEPPER_DRIVER_INTERRUPT();
+
+    shaping[axis].set(type, frequency, damping);
+
+    if (was_enabled) ENABLE_STEPPER_DRIVER_INTERRUPT();
+  }
+
+#endif // INPUT_SHAPING
+
 // Check if the given block is busy or not - Must not be called from ISR contexts
 // The current_block could change in the middle of the read by an Stepper ISR, so
 // we must explicitly prevent that!
@@ -2107,6 +2341,10 @@ void Stepper::init() {
     E_AXIS_INIT(5);
   #endif
 
+  #if ENABLED(INPUT_SHAPING)
+    LOOP_L_N(i, 2) shaping[i].set(shaper_type[i], shaper_frequency[i], shaper_damping[i]);
+  #endif
+
   // Init Stepper ISR to 122 Hz for quick starting
   HAL_timer_start(STEP_TIMER_NUM, 122);
 
@@ -2149,6 +2387,14 @@ void Stepper::_set_position(const int32_t &a, const int32_t &b, const int32_t &c
     count_position[Z_AXIS] = c;
   #endif
   count_position[E_AXIS] = e;
+
+  #if ENABLED(INPUT_SHAPING)
+    // A sync block can arrive while X and Y echoes are still queued, as
+    // with G92 E0 mid-print. The axes are only relabeled, so keep the
+    // echoes and count their steps as already taken toward the new position.
+    count_position[X_AXIS] -= shaping[X_AXIS].steps_behind();
+    count_position[Y_AXIS] -= shaping[Y_AXIS].steps_behind();
+  #endif
 }
 
 /**
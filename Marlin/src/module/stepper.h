@@ -238,6 +238,10 @@
 #include "../module/planner.h"
 #include "../core/language.h"
 
+#if ENABLED(INPUT_SHAPING)
+  #include "input_shaping.h"
+#endif
+
 class Stepper {
 
   public:
@@ -246,6 +250,11 @@ class Stepper {
       static bool separate_multi_axis;
     #endif
 
+    #if ENABLED(PARALLEL_HOMING)
+      static uint8_t homing_axes;             // Axes homing together, each stopping at its own endstop
+      static volatile uint8_t homing_stopped; // Axes that have reached their endstop
+    #endif
+
     #if HAS_MOTOR_CURRENT_PWM
       #ifndef PWM_MOTOR_CURRENT
         #define PWM_MOTOR_CURRENT DEFAULT_PWM_MOTOR_CURRENT
@@ -300,6 +309,12 @@ class Stepper {
                     decelerate_after,       // The point from where we need to start decelerating
                     step_event_count;       // The total event count for the current block
 
+    #if ENABLED(NATIVE_ARC_BLOCKS)
+      static ArcWalker arc_walker;          // Walks the chords of the current arc block
+      static uint32_t advance_divisor_xy,   // Bresenham divisor for X and Y, set per chord of an arc
+                      arc_chord_events;     // Step events left in the current chord
+    #endif
+
     #if EXTRUDERS > 1 || ENABLED(MIXING_EXTRUDER)
       static uint8_t stepper_extruder;
     #else
@@ -319,6 +334,12 @@ class Stepper {
     #endif
 
     static uint32_t nextMainISR;   // time remaining for the next Step ISR
+    #if ENABLED(INPUT_SHAPING)
+      static ShapedAxis shaping[2];         // Shapers for X and Y
+      static uint32_t nextShapingISR,       // Time remaining for the next shaping ISR
+                      shaping_time;         // Stepper timer ticks, to time the echoes
+      static uint8_t shaping_dir_bits;      // X and Y motor directions, as set on the pins
+    #endif
     #if ENABLED(LIN_ADVANCE)
       static uint32_t nextAdvanceISR, LA_isr_rate;
       static uint16_t LA_current_adv_steps, LA_final_adv_steps, LA_max_adv_steps; // Copy from current executed block. Needed because current_block is set to NULL "too early".
@@ -369,6 +390,20 @@ class Stepper {
       static uint32_t advance_isr();
     #endif
 
+    #if ENABLED(INPUT_SHAPING)
+      // The input shaping ISR, stepping X and Y for the echoes
+      static uint32_t shaping_isr();
+
+      // M593 settings for X and Y
+      static ShaperType shaper_type[2];
+      static float shaper_frequency[2], shaper_damping[2];
+
+      static void set_shaper(const AxisEnum axis, const ShaperType type, const float &frequency, const float &damping);
+
+      // Echoes are still to be stepped
+      FORCE_INLINE static bool shaping_busy() { return !shaping[X_AXIS].idle() || !shaping[Y_AXIS].idle(); }
+    #endif
+
     // Check if the given block is busy or not - Must not be called from ISR contexts
     static bool is_block_busy(const block_t* const block);
 
@@ -385,6 +420,13 @@ class Stepper {
     // Quickly stop all steppers
     FORCE_INLINE static void quick_stop() { abort_current_block = true; }
 
+    #if ENABLED(POWER_LOSS_EXACT_RESUME)
+      // The part of 'block' done so far, 0 if it hasn't started. Call with the stepper ISR held.
+      FORCE_INLINE static float block_progress(const block_t * const block) {
+        return (block == current_block && step_event_count) ? float(step_events_completed) / step_event_count : 0;
+      }
+    #endif
+
     // The direction of a single motor
     FORCE_INLINE static bool motor_direction(const AxisEnum axis) { return TEST(last_direction_bits, axis); }
 
@@ -438,6 +480,25 @@ class Stepper {
       FORCE_INLINE static void set_z3_lock(const bool state) { locked_Z3_motor = state; }
     #endif
 
+    #if ENABLED(PARALLEL_HOMING)
+      // Start (or end, with 0) a move where the given axes stop one by one
+      FORCE_INLINE static void set_parallel_homing(const uint8_t axis_bits) { homing_stopped = 0; homing_axes = axis_bits; }
+
+      // All the axes of the parallel homing move have stopped
+      FORCE_INLINE static bool parallel_homing_done() { return homing_stopped == homing_axes; }
+
+      /**
+       * Stop an axis that hit its endstop. Return true when the
+       * whole move should end: all the axes have stopped, or the
+       * axis isn't homing in parallel.
+       */
+      FORCE_INLINE static bool parallel_homing_stop(const AxisEnum axis) {
+        if (!TEST(homing_axes, axis)) return true;
+        homing_stopped |= _BV(axis);
+        return parallel_homing_done();
+      }
+    #endif
+
     #if ENABLED(BABYSTEPPING)
       static void babystep(const AxisEnum axis, const bool direction); // perform a short step with a single stepper motor, outside of any convention
     #endif
@@ -478,6 +539,11 @@ class Stepper {
 
   private:
 
+    #if ENABLED(NATIVE_ARC_BLOCKS)
+      // Set up Bresenham for the next chord of an arc block
+      static void next_arc_chord();
+    #endif
+
     // Set the current position in steps
     static void _set_position(const int32_t &a, const int32_t &b, const int32_t &c, const int32_t &e);
 
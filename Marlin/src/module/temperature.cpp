@@ -254,6 +254,10 @@ int16_t Temperature::current_temperature_raw[HOTENDS], // = { 0 }
 
 volatile bool Temperature::temp_meas_ready = false;
 
+#if ENABLED(PRINTCOUNTER_MAINTENANCE)
+  PGM_P volatile Temperature::kill_msg; // = NULL
+#endif
+
 #if ENABLED(PIDTEMP)
   #if ENABLED(PID_EXTRUSION_SCALING)
     long Temperature::last_e_position;
@@ -665,7 +669,16 @@ void Temperature::_temp_error(const int8_t heater, PGM_P const serial_msg, PGM_P
     if (!killed) {
       Running = false;
       killed = true;
-      kill(lcd_msg);
+      #if ENABLED(PRINTCOUNTER_MAINTENANCE)
+        // MAXTEMP and MINTEMP come from the temperature ISR, where the
+        // persistent store can't be written. Count the fault and leave
+        // the save and kill() to manage_heater(), with the heaters off.
+        disable_all_heaters();
+        print_job_timer.incThermalError(heater);
+        kill_msg = lcd_msg;
+      #else
+        kill(lcd_msg);
+      #endif
     }
     else
       disable_all_heaters(); // paranoia
@@ -864,6 +877,14 @@ void Temperature::manage_heater() {
     if (emergency_parser.killed_by_M112) kill();
   #endif
 
+  #if ENABLED(PRINTCOUNTER_MAINTENANCE)
+    // A thermal fault was counted, maybe in the ISR. Save it here, then halt.
+    if (kill_msg) {
+      print_job_timer.saveStats();
+      kill(kill_msg);
+    }
+  #endif
+
   if (!temp_meas_ready) return;
 
   updateTemperaturesFromRawValues(); // also resets the watchdog
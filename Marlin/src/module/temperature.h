@@ -724,6 +724,10 @@ class Temperature {
       static float get_pid_output_bed();
     #endif
 
+    #if ENABLED(PRINTCOUNTER_MAINTENANCE)
+      static PGM_P volatile kill_msg;   // Set by a thermal fault, for manage_heater() to kill()
+    #endif
+
     static void _temp_error(const int8_t e, PGM_P const serial_msg, PGM_P const lcd_msg);
     static void min_temp_error(const int8_t e);
     static void max_temp_error(const int8_t e);
@@ -34,6 +34,14 @@ class Sd2Card {
     bool init(uint8_t sckRateID = 0, uint8_t chipSelectPin = 0) { return SDIO_Init(); }
     bool readBlock(uint32_t block, uint8_t *dst) { return SDIO_ReadBlock(block, dst); }
     bool writeBlock(uint32_t block, const uint8_t *src) { return SDIO_WriteBlock(block, src); }
+
+    // Multi-block writes are sent one block at a time
+    bool writeStart(const uint32_t block, const uint32_t eraseCount) { UNUSED(eraseCount); pos = block; return true; }
+    bool writeData(const uint8_t *src) { return writeBlock(pos++, src); }
+    bool writeStop() { return true; }
+
+  private:
+    uint32_t pos;
 };
 
 #endif // SDIO_SUPPORT
@@ -147,19 +147,37 @@ bool SdBaseFile::contiguousRange(uint32_t* bgnBlock, uint32_t* endBlock) {
  *
  */
 bool SdBaseFile::createContiguous(SdBaseFile* dirFile, const char* path, uint32_t size) {
-  uint32_t count;
   // don't allow zero length file
   if (size == 0) return false;
   if (!open(dirFile, path, O_CREAT | O_EXCL | O_RDWR)) return false;
 
+  if (!preAllocate(size)) {
+    // remove only if the clusters could not be allocated
+    if (firstCluster_ == 0) remove();
+    return false;
+  }
+  return true;
+}
+
+/**
+ * Allocate contiguous clusters for an empty file and set its size, so
+ * its data can be written with raw block writes. The file position is
+ * left at the start of the file.
+ *
+ * \param[in] size The desired file size.
+ *
+ * \return true for success, false for failure.
+ * Reasons for failure include the file is not open for write,
+ * already has data, or the volume has no contiguous free space.
+ */
+bool SdBaseFile::preAllocate(const uint32_t size) {
+  if (size == 0 || !isFile() || !(flags_ & O_WRITE) || firstCluster_) return false;
+
   // calculate number of clusters needed
-  count = ((size - 1) >> (vol_->clusterSizeShift_ + 9)) + 1;
+  const uint32_t count = ((size - 1) >> (vol_->clusterSizeShift_ + 9)) + 1;
 
   // allocate clusters
-  if (!vol_->allocContiguous(count, &firstCluster_)) {
-    remove();
-    return false;
-  }
+  if (!vol_->allocContiguous(count, &firstCluster_)) return false;
   fileSize_ = size;
 
   // insure sync() will update dir entry
@@ -194,6 +194,7 @@ class SdBaseFile {
   bool contiguousRange(uint32_t* bgnBlock, uint32_t* endBlock);
   bool createContiguous(SdBaseFile* dirFile,
                         const char* path, uint32_t size);
+  bool preAllocate(const uint32_t size);
   /**
    * \return The current cluster number for a file or directory.
    */
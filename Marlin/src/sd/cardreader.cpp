@@ -115,6 +115,17 @@ LsAction CardReader::lsAction; //stored for recursion.
 uint16_t CardReader::nrFiles; //counter for the files in the current directory and recycled as position counter for getting the nrFiles'th name in the directory.
 char *CardReader::diveDirName;
 
+#if ENABLED(SDCARD_DIR_INDEX)
+  bool CardReader::dir_indexed; // = false
+  uint16_t CardReader::dir_file_count, CardReader::dir_index[SDCARD_DIR_INDEX_LIMIT];
+#endif
+
+#if ENABLED(SDCARD_LOG_WRITE_BEHIND)
+  uint8_t CardReader::log_buffer[2][512], CardReader::log_index, CardReader::log_pending;
+  uint16_t CardReader::log_fill;
+  uint32_t CardReader::log_block, CardReader::log_blocks_free, CardReader::log_size;
+#endif
+
 CardReader::CardReader() {
   #if ENABLED(SDCARD_SORT_ALPHA)
     sort_count = 0;
@@ -151,6 +162,17 @@ char *createFilename(char *buffer, const dir_t &p) {
   return buffer;
 }
 
+/**
+ * Return 'true' for a folder or G-code file that should be listed
+ */
+static bool is_dir_or_gcode(const dir_t &p) {
+  const uint8_t pn0 = p.name[0];
+  if (pn0 == DIR_NAME_FREE || pn0 == DIR_NAME_DELETED || pn0 == '.') return false;
+  if (CardReader::longFilename[0] == '.') return false;
+  if (!DIR_IS_FILE_OR_SUBDIR(&p) || (p.attributes & DIR_ATT_HIDDEN)) return false;
+  return DIR_IS_SUBDIR(&p) || (p.name[8] == 'G' && p.name[9] != '~');
+}
+
 /**
  * Dive into a folder and recurse depth-first to perform a pre-set operation lsAction:
  *   LS_Count       - Add +1 to nrFiles for every file within the parent
@@ -210,17 +232,10 @@ void CardReader::lsDive(const char *prepend, SdFile parent, const char * const m
       // close() is done automatically by destructor of SdFile
     }
     else {
-      uint8_t pn0 = p.name[0];
-      if (pn0 == DIR_NAME_FREE) break;
-      if (pn0 == DIR_NAME_DELETED || pn0 == '.') continue;
-      if (longFilename[0] == '.') continue;
-
-      if (!DIR_IS_FILE_OR_SUBDIR(&p) || (p.attributes & DIR_ATT_HIDDEN)) continue;
+      if (!is_dir_or_gcode(p)) continue;
 
       flag.filenameIsDir = DIR_IS_SUBDIR(&p);
 
-      if (!flag.filenameIsDir && (p.name[8] != 'G' || p.name[9] == '~')) continue;
-
       switch (lsAction) {  // 1 based file count
         case LS_Count:
           nrFiles++;
@@ -363,6 +378,10 @@ void CardReader::initsd() {
   flag.detected = false;
   if (root.isOpen()) root.close();
 
+  #if ENABLED(POWER_LOSS_JOURNAL)
+    recovery.journal_block = 0; // Look up the journal again on the new volume
+  #endif
+
   #ifndef SPI_SPEED
     #define SPI_SPEED SPI_FULL_SPEED
   #endif
@@ -419,6 +438,9 @@ void CardReader::stopSDPrint(
     did_pause_print = 0;
   #endif
   flag.sdprinting = flag.abort_sd_printing = false;
+  #if ENABLED(SDCARD_FILE_INDEX)
+    file_index.stop();
+  #endif
   if (isFileOpen()) file.close();
   #if SD_RESORT
     if (re_sort) presort();
@@ -428,6 +450,14 @@ void CardReader::stopSDPrint(
 void CardReader::openLogFile(char * const path) {
   flag.logging = true;
   openFile(path, false);
+  #if ENABLED(SDCARD_LOG_WRITE_BEHIND)
+    // Reserve a contiguous area for whole-block writes. Without it the log
+    // is written through the file system.
+    log_index = log_pending = 0;
+    log_fill = log_size = 0;
+    log_block = preallocateFile(uint32_t(SDCARD_LOG_PREALLOCATE_KB) * 1024UL);
+    log_blocks_free = log_block ? uint32_t(SDCARD_LOG_PREALLOCATE_KB) * 2UL : 0;
+  #endif
 }
 
 void appendAtom(SdFile &file, char *& dst, uint8_t &cnt) {
@@ -506,6 +536,9 @@ void CardReader::openFile(char * const path, const bool read, const bool subcall
 
       getfilename(0, fname);
       ui.set_status(longFilename[0] ? longFilename : fname);
+      #if ENABLED(SDCARD_FILE_INDEX)
+        if (!subcall) file_index.select(*curDir, fname, file);
+      #endif
       //if (longFilename[0]) {
       //  SERIAL_ECHOPAIR(MSG_SD_FILE_LONG_NAME, longFilename);
       //}
@@ -524,6 +557,7 @@ void CardReader::openFile(char * const path, const bool read, const bool subcall
     }
     else {
       flag.saving = true;
+      invalidate_dir_index();
       getfilename(0, fname);
       #if ENABLED(EMERGENCY_PARSER)
         emergency_parser.disable();
@@ -534,6 +568,23 @@ void CardReader::openFile(char * const path, const bool read, const bool subcall
   }
 }
 
+#if defined(FAST_FILE_TRANSFER_PACKET_SIZE) || ENABLED(SDCARD_LOG_WRITE_BEHIND)
+
+  /**
+   * Give the empty file open for writing a contiguous area of the given size.
+   * Return its first block for raw writes, or 0 if it couldn't be allocated.
+   */
+  uint32_t CardReader::preallocateFile(const uint32_t size) {
+    uint32_t bgn_block, end_block;
+    if (!file.isOpen() || !file.preAllocate(size) || !file.contiguousRange(&bgn_block, &end_block))
+      return 0;
+    // Drop any stale copy of a block in the new area
+    if (!volume.cacheClear()) return 0;
+    return bgn_block;
+  }
+
+#endif
+
 void CardReader::removeFile(const char * const name) {
   if (!isDetected()) return;
 
@@ -546,6 +597,7 @@ void CardReader::removeFile(const char * const name) {
   if (file.remove(curDir, fname)) {
     SERIAL_ECHOLNPAIR("File deleted:", fname);
     sdpos = 0;
+    invalidate_dir_index();
     #if ENABLED(SDCARD_SORT_ALPHA)
       presort();
     #endif
@@ -566,6 +618,13 @@ void CardReader::report_status(
     SERIAL_ECHO_P(port, sdpos);
     SERIAL_CHAR_P(port, '/');
     SERIAL_ECHOLN_P(port, filesize);
+    #if ENABLED(SDCARD_FILE_INDEX)
+      if (file_index.ready()) {
+        SERIAL_ECHOPAIR_P(port, "Layer ", file_index.current_layer(sdpos));
+        SERIAL_ECHOPAIR_P(port, "/", file_index.layer_count());
+        SERIAL_ECHOLNPAIR_P(port, " Remaining ", file_index.remaining(sdpos, print_job_timer.duration()));
+      }
+    #endif
   }
   else
     SERIAL_ECHOLNPGM_P(port, MSG_SD_NOT_PRINTING);
@@ -584,11 +643,68 @@ void CardReader::write_command(char *buf) {
   end[1] = '\r';
   end[2] = '\n';
   end[3] = '\0';
+
+  #if ENABLED(SDCARD_LOG_WRITE_BEHIND)
+    if (log_block) {
+      log_write(begin);
+      return;
+    }
+  #endif
+
   file.write(begin);
 
   if (file.writeError) SERIAL_ERROR_MSG(MSG_SD_ERR_WRITE_TO_FILE);
 }
 
+#if ENABLED(SDCARD_LOG_WRITE_BEHIND)
+
+  /**
+   * Buffer a log line. Full blocks are left for idle() to write, unless
+   * both buffers are full. Once the reserved area is used up the rest
+   * of the log goes through the file system.
+   */
+  void CardReader::log_write(const char *str) {
+    for (; *str; str++) {
+      log_buffer[log_index][log_fill] = *str;
+      log_size++;
+      if (++log_fill < 512) continue;
+
+      log_fill = 0;
+      log_index ^= 1;
+      log_pending++;
+      if (!--log_blocks_free) {
+        flush_log(true);
+        log_block = 0;
+        if (str[1]) file.write(str + 1);
+        if (file.writeError) SERIAL_ERROR_MSG(MSG_SD_ERR_WRITE_TO_FILE);
+        return;
+      }
+      if (log_pending > 1) flush_log();
+    }
+  }
+
+  /**
+   * Write the oldest full log block to the reserved area. With 'all'
+   * write every buffered block, padding the partial one with zeros.
+   */
+  void CardReader::flush_log(const bool all/*=false*/) {
+    if (!log_block) return;
+    while (log_pending) {
+      // With both buffers full the oldest is the one to be filled next
+      const uint8_t i = log_index ^ (log_pending & 1);
+      if (!sd2card.writeBlock(log_block, log_buffer[i])) SERIAL_ERROR_MSG(MSG_SD_ERR_WRITE_TO_FILE);
+      log_block++;
+      log_pending--;
+      if (!all) return;
+    }
+    if (all && log_fill) {
+      memset(&log_buffer[log_index][log_fill], 0, 512 - log_fill);
+      if (!sd2card.writeBlock(log_block, log_buffer[log_index])) SERIAL_ERROR_MSG(MSG_SD_ERR_WRITE_TO_FILE);
+    }
+  }
+
+#endif
+
 //
 // Run the next autostart file. Called:
 // - On boot after successful card init
@@ -629,6 +745,16 @@ void CardReader::beginautostart() {
 }
 
 void CardReader::closefile(const bool store_location) {
+  #if ENABLED(SDCARD_LOG_WRITE_BEHIND)
+    if (log_block) {
+      flush_log(true);
+      file.truncate(log_size);  // Release the unused part of the reserved area
+      log_block = 0;
+    }
+  #endif
+  #if ENABLED(SDCARD_FILE_INDEX)
+    file_index.stop();
+  #endif
   file.sync();
   file.close();
   flag.saving = flag.logging = false;
@@ -662,6 +788,21 @@ void CardReader::getfilename(uint16_t nr, const char * const match/*=NULL*/) {
       return;
     }
   #endif // SDSORT_CACHE_NAMES
+  #if ENABLED(SDCARD_DIR_INDEX)
+    if (match == NULL) {
+      if (!dir_indexed) index_dir();
+      if (nr < dir_file_count && nr < SDCARD_DIR_INDEX_LIMIT) {
+        dir_t p;
+        workDir.seekSet(uint32_t(dir_index[nr]) << 5);
+        if (workDir.readDir(&p, longFilename) > 0 && is_dir_or_gcode(p)) {
+          createFilename(filename, p);
+          flag.filenameIsDir = DIR_IS_SUBDIR(&p);
+          return;
+        }
+        dir_indexed = false; // The directory changed. Fall back to a scan.
+      }
+    }
+  #endif
   lsAction = LS_GetFilename;
   nrFile_index = nr;
   workDir.rewind();
@@ -669,14 +810,42 @@ void CardReader::getfilename(uint16_t nr, const char * const match/*=NULL*/) {
 }
 
 uint16_t CardReader::getnrfilenames() {
-  lsAction = LS_Count;
-  nrFiles = 0;
-  workDir.rewind();
-  lsDive(NULL, workDir);
+  #if ENABLED(SDCARD_DIR_INDEX)
+    if (!dir_indexed) index_dir();
+    nrFiles = dir_file_count;
+  #else
+    lsAction = LS_Count;
+    nrFiles = 0;
+    workDir.rewind();
+    lsDive(NULL, workDir);
+  #endif
   //SERIAL_ECHOLN(nrFiles);
   return nrFiles;
 }
 
+#if ENABLED(SDCARD_DIR_INDEX)
+
+  /**
+   * Read the working directory once, noting the slot where reading
+   * starts for each listed item so getfilename() can seek to it
+   * instead of reading every entry before it.
+   */
+  void CardReader::index_dir() {
+    dir_t p;
+    dir_file_count = 0;
+    workDir.rewind();
+    for (;;) {
+      const uint32_t pos = workDir.curPosition();
+      if (workDir.readDir(&p, longFilename) <= 0) break;
+      if (!is_dir_or_gcode(p)) continue;
+      if (dir_file_count < SDCARD_DIR_INDEX_LIMIT) dir_index[dir_file_count] = pos >> 5;
+      dir_file_count++;
+    }
+    dir_indexed = true;
+  }
+
+#endif
+
 /**
  * Dive to the given DOS 8.3 file path, with optional echo of the dive paths.
  *
@@ -722,6 +891,7 @@ void CardReader::chdir(const char * relpath) {
     workDir = newDir;
     if (workDirDepth < MAX_DIR_DEPTH)
       workDirParents[workDirDepth++] = workDir;
+    invalidate_dir_index();
     #if ENABLED(SDCARD_SORT_ALPHA)
       presort();
     #endif
@@ -735,6 +905,7 @@ void CardReader::chdir(const char * relpath) {
 int8_t CardReader::updir() {
   if (workDirDepth > 0) {                                               // At least 1 dir has been saved
     workDir = --workDirDepth ? workDirParents[workDirDepth - 1] : root; // Use parent, or root if none
+    invalidate_dir_index();
     #if ENABLED(SDCARD_SORT_ALPHA)
       presort();
     #endif
@@ -747,6 +918,7 @@ void CardReader::setroot() {
     SERIAL_ECHOLNPGM(MSG_SD_WORKDIR_FAIL);
   }*/
   workDir = root;
+  invalidate_dir_index();
   #if ENABLED(SDCARD_SORT_ALPHA)
     presort();
   #endif
@@ -1072,24 +1244,67 @@ void CardReader::printingHasFinished() {
       SERIAL_CHAR('.');
       SERIAL_EOL();
     }
-    else if (!read)
+    else if (!read) {
+      invalidate_dir_index();
       SERIAL_ECHOLNPAIR(MSG_SD_WRITE_TO_FILE, job_recovery_file_name);
+    }
   }
 
   // Removing the job recovery file currently requires closing
   // the file being printed, so during SD printing the file should
   // be zeroed and written instead of deleted.
   void CardReader::removeJobRecoveryFile() {
-    if (jobRecoverFileExists()) {
-      //closefile();
-      removeFile(job_recovery_file_name);
-      #if ENABLED(DEBUG_POWER_LOSS_RECOVERY)
-        SERIAL_ECHOPGM("Power-loss file delete");
-        serialprintPGM(jobRecoverFileExists() ? PSTR(" failed.\n") : PSTR("d.\n"));
-      #endif
-    }
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      // The journal stays allocated. Clearing its records is enough.
+      if (isDetected()) recovery.journal_clear();
+    #else
+      if (jobRecoverFileExists()) {
+        //closefile();
+        removeFile(job_recovery_file_name);
+        #if ENABLED(DEBUG_POWER_LOSS_RECOVERY)
+          SERIAL_ECHOPGM("Power-loss file delete");
+          serialprintPGM(jobRecoverFileExists() ? PSTR(" failed.\n") : PSTR("d.\n"));
+        #endif
+      }
+    #endif
   }
 
+  #if ENABLED(POWER_LOSS_JOURNAL)
+
+    /**
+     * Get the first block of the contiguous journal file, creating it if it's
+     * missing. An old-style recovery file or one of the wrong size is replaced.
+     * Return 0 if no journal could be made.
+     */
+    uint32_t CardReader::jobJournalBlock(const uint32_t size, bool &created) {
+      created = false;
+      if (!isDetected()) return 0;
+
+      uint32_t bgn_block, end_block;
+      if (recovery.file.open(&root, job_recovery_file_name, O_READ)) {
+        const bool usable = recovery.file.fileSize() == size && recovery.file.contiguousRange(&bgn_block, &end_block);
+        recovery.file.close();
+        if (usable) return bgn_block;
+        // Remove with the recovery file object so the file being printed stays open
+        SdFile::remove(&root, job_recovery_file_name);
+      }
+
+      invalidate_dir_index();
+      if (!recovery.file.createContiguous(&root, job_recovery_file_name, size)) {
+        SERIAL_ECHOPAIR(MSG_SD_OPEN_FILE_FAIL, job_recovery_file_name);
+        SERIAL_CHAR('.');
+        SERIAL_EOL();
+        return 0;
+      }
+      const bool usable = recovery.file.contiguousRange(&bgn_block, &end_block);
+      recovery.file.close();
+      if (!usable) return 0;
+      created = true;
+      return bgn_block;
+    }
+
+  #endif // POWER_LOSS_JOURNAL
+
 #endif // POWER_LOSS_RECOVERY
 
 #endif // SDSUPPORT
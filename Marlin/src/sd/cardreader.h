@@ -33,6 +33,10 @@
 
 #include "SdFile.h"
 
+#if ENABLED(SDCARD_FILE_INDEX)
+  #include "../feature/file_index.h"
+#endif
+
 enum LsAction : uint8_t { LS_SerialPrint, LS_Count, LS_GetFilename };
 
 typedef struct {
@@ -124,6 +128,9 @@ public:
     static bool jobRecoverFileExists();
     static void openJobRecoveryFile(const bool read);
     static void removeJobRecoveryFile();
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      static uint32_t jobJournalBlock(const uint32_t size, bool &created);
+    #endif
   #endif
 
   static inline void pauseSDPrint() { flag.sdprinting = false; }
@@ -135,12 +142,26 @@ public:
   static inline int16_t get() { sdpos = file.curPosition(); return (int16_t)file.read(); }
   static inline void setIndex(const uint32_t index) { sdpos = index; file.seekSet(index); }
   static inline uint32_t getIndex() { return sdpos; }
-  static inline uint8_t percentDone() { return (isFileOpen() && filesize) ? sdpos / ((filesize + 99) / 100) : 0; }
+  static inline uint8_t percentDone() {
+    #if ENABLED(SDCARD_FILE_INDEX)
+      if (isFileOpen() && file_index.ready()) return file_index.percent_done(sdpos);
+    #endif
+    return (isFileOpen() && filesize) ? sdpos / ((filesize + 99) / 100) : 0;
+  }
   static inline char* getWorkDirName() { workDir.getFilename(filename); return filename; }
   static inline int16_t read(void* buf, uint16_t nbyte) { return file.isOpen() ? file.read(buf, nbyte) : -1; }
   static inline int16_t write(void* buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
 
   static Sd2Card& getSd2Card() { return sd2card; }
+  static SdVolume& getVolume() { return volume; }
+
+  #if defined(FAST_FILE_TRANSFER_PACKET_SIZE) || ENABLED(SDCARD_LOG_WRITE_BEHIND)
+    static uint32_t preallocateFile(const uint32_t size);
+  #endif
+
+  #if ENABLED(SDCARD_LOG_WRITE_BEHIND)
+    static void flush_log(const bool all=false);
+  #endif
 
   #if ENABLED(AUTO_REPORT_SD_STATUS)
     static void auto_report_sd_status(void);
@@ -254,6 +275,29 @@ private:
     static void flush_presort();
   #endif
 
+  // Directory slot where reading starts for each listed item
+  #if ENABLED(SDCARD_DIR_INDEX)
+    static bool dir_indexed;        // The index matches the working directory
+    static uint16_t dir_file_count, // Count of all listed items, indexed or not
+                    dir_index[SDCARD_DIR_INDEX_LIMIT];
+    static void index_dir();
+    FORCE_INLINE static void invalidate_dir_index() { dir_indexed = false; }
+  #else
+    FORCE_INLINE static void invalidate_dir_index() {}
+  #endif
+
+  // Log blocks waiting to be written to the preallocated area
+  #if ENABLED(SDCARD_LOG_WRITE_BEHIND)
+    static uint8_t log_buffer[2][512],
+                   log_index,       // Block being filled
+                   log_pending;     // Full blocks not yet written
+    static uint16_t log_fill;       // Bytes in the block being filled
+    static uint32_t log_block,      // Next block to write, or 0 to write through the file system
+                    log_blocks_free,// Reserved blocks not yet filled
+                    log_size;       // Bytes logged to the reserved area
+    static void log_write(const char *str);
+  #endif
+
   #if ENABLED(AUTO_REPORT_SD_STATUS)
     static uint8_t auto_report_sd_interval;
     static millis_t next_sd_report_ms;
@@ -119,6 +119,10 @@ bool Sd2Card::init(const uint8_t sckRateID/*=0*/, const pin_t chipSelectPin/*=SD
     lun0_capacity = bulk.GetCapacity(0);
     SERIAL_ECHOLNPAIR("LUN Capacity (in blocks): ", lun0_capacity);
   #endif
+  #ifdef USB_READ_AHEAD_BLOCKS
+    ahead_count = 0;
+    last_block = 0xFFFFFFFE;
+  #endif
   return true;
 }
 
@@ -143,6 +147,31 @@ bool Sd2Card::readBlock(uint32_t block, uint8_t* dst) {
       SERIAL_ECHOLNPAIR("Read block ", block);
     #endif
   #endif
+  #ifdef USB_READ_AHEAD_BLOCKS
+    // Serve a sector that was read ahead
+    if (block - ahead_block < ahead_count) {
+      memcpy(dst, ahead_buffer[block - ahead_block], 512);
+      last_block = block;
+      return true;
+    }
+    // A sequential reader gets the next sectors in one bulk transfer.
+    // Other reads (FAT, directory) leave the buffer alone.
+    const bool sequential = block == last_block + 1;
+    last_block = block;
+    if (sequential) {
+      const uint32_t capacity = bulk.GetCapacity(0);
+      if (block < capacity) {
+        const uint8_t count = MIN(capacity - block, uint32_t(USB_READ_AHEAD_BLOCKS));
+        if (bulk.Read(0, block, 512, count, ahead_buffer[0]) == 0) {
+          ahead_block = block;
+          ahead_count = count;
+          memcpy(dst, ahead_buffer[0], 512);
+          return true;
+        }
+        ahead_count = 0;  // Retry the single sector below
+      }
+    }
+  #endif
   const bool ok = (bulk.Read(0, block, 512, 1, dst) == 0);
   #if defined(LULZBOT_USB_READ_ERROR_IS_FATAL)
   if(!ok) kill(PSTR("USB Read Error"));
@@ -161,6 +190,9 @@ bool Sd2Card::writeBlock(uint32_t block, const uint8_t* src) {
       SERIAL_ECHOLNPAIR("Write block ", block);
     #endif
   #endif
+  #ifdef USB_READ_AHEAD_BLOCKS
+    if (block - ahead_block < ahead_count) ahead_count = 0;
+  #endif
   return bulk.Write(0, block, 512, 1, src) == 0;
 }
 
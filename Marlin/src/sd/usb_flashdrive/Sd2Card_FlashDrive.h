@@ -74,6 +74,12 @@ class Sd2Card {
       uint32_t lun0_capacity;
     #endif
 
+    #ifdef USB_READ_AHEAD_BLOCKS
+      // Sectors read ahead of a sequential reader
+      uint8_t ahead_buffer[USB_READ_AHEAD_BLOCKS][512], ahead_count;
+      uint32_t ahead_block, last_block;
+    #endif
+
     static inline bool ready() { return state == USB_HOST_INITIALIZED; }
 
   public: